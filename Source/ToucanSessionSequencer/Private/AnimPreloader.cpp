@@ -0,0 +1,172 @@
+#include "AnimPreloader.h"
+#include "Misc/ConfigCacheIni.h"
+#include "SeqQueue.h"
+
+FAnimPreloader::FAnimPreloader()
+{
+#if WITH_EDITOR
+    const FString& Ini = GEditorPerProjectIni;
+#else
+    const FString& Ini = GGameIni;
+#endif
+    GConfig->GetInt(ConfigSection, LookAheadCountKey, LookAheadCount, Ini);
+    LookAheadCount = FMath::Clamp(LookAheadCount, 0, 4);
+}
+
+void FAnimPreloader::PreloadAfterCurrent()
+{
+    if (LookAheadCount <= 0)
+    {
+        return;
+    }
+
+    if (!QueueChangedHandle.IsValid())
+    {
+        QueueChangedHandle = FSeqQueue::Get().OnQueueChanged().AddRaw(this, &FAnimPreloader::Prune);
+    }
+
+    TArray<FSoftObjectPath> Window;
+    GatherWindow(Window);
+
+    // The current clip is already loaded and referenced by the sequence; its handle has done its job
+    const FSeqQueue& Queue = FSeqQueue::Get();
+    if (Queue.GetAll().IsValidIndex(Queue.GetCurrentIndex()))
+    {
+        Window.RemoveSingle(Queue.GetAll()[Queue.GetCurrentIndex()].Path);
+    }
+
+    for (auto It = Handles.CreateIterator(); It; ++It)
+    {
+        if (!Window.Contains(It.Key()))
+        {
+            It.Value()->ReleaseHandle();
+            It.RemoveCurrent();
+        }
+    }
+
+    for (const FSoftObjectPath& Path : Window)
+    {
+        // Loaded while it was further down the window; listeners may only care now that it is next
+        if (const TSharedPtr<FStreamableHandle>* Existing = Handles.Find(Path))
+        {
+            if ((*Existing)->HasLoadCompleted())
+            {
+                QueueBroadcast(Path);
+            }
+            continue;
+        }
+
+        // Registered before the request, since an asset already in memory may complete immediately
+        Handles.Add(Path);
+        TSharedPtr<FStreamableHandle> Handle = Streamable.RequestAsyncLoad(
+            Path, FStreamableDelegate::CreateRaw(this, &FAnimPreloader::OnRequestFinished, Path), FStreamableManager::DefaultAsyncLoadPriority);
+        if (Handle.IsValid())
+        {
+            Handles[Path] = Handle;
+            UE_LOG(LogTemp, Verbose, TEXT("[ToucanSequencer] Preloading animation: %s"), *Path.ToString());
+        }
+        else
+        {
+            Handles.Remove(Path);
+        }
+    }
+}
+
+void FAnimPreloader::Shutdown()
+{
+    if (BroadcastTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(BroadcastTickerHandle);
+        BroadcastTickerHandle.Reset();
+    }
+    PendingBroadcasts.Reset();
+
+    if (QueueChangedHandle.IsValid())
+    {
+        FSeqQueue::Get().OnQueueChanged().Remove(QueueChangedHandle);
+        QueueChangedHandle.Reset();
+    }
+
+    for (TPair<FSoftObjectPath, TSharedPtr<FStreamableHandle>>& Pair : Handles)
+    {
+        Pair.Value->CancelHandle();
+    }
+    Handles.Reset();
+}
+
+void FAnimPreloader::GatherWindow(TArray<FSoftObjectPath>& OutPaths) const
+{
+    const FSeqQueue& Queue = FSeqQueue::Get();
+    const TArray<FQueuedAnim>& Items = Queue.GetAll();
+    const int32 CurrentIndex = Queue.GetCurrentIndex();
+    if (Items.IsValidIndex(CurrentIndex))
+    {
+        OutPaths.Add(Items[CurrentIndex].Path);
+    }
+
+    // The items "Load next" will reach, in order, stopping before the current one comes round again
+    int32 NumPlanned = 0;
+    const int32 FirstIndex = Queue.FindNextUnprocessed(CurrentIndex);
+    for (int32 Index = FirstIndex; Index != INDEX_NONE && Index != CurrentIndex && NumPlanned < LookAheadCount; )
+    {
+        OutPaths.Add(Items[Index].Path);
+        ++NumPlanned;
+
+        Index = Queue.FindNextUnprocessed(Index);
+        if (Index == FirstIndex)
+        {
+            break;
+        }
+    }
+}
+
+void FAnimPreloader::Prune()
+{
+    if (Handles.Num() == 0)
+    {
+        return;
+    }
+
+    // Only releases here; new requests wait for PreloadAfterCurrent so they never compete with the clip being opened.
+    // The current item stays in the window so a preload that just became current survives until its TryLoad.
+    TArray<FSoftObjectPath> Window;
+    GatherWindow(Window);
+    for (auto It = Handles.CreateIterator(); It; ++It)
+    {
+        if (!Window.Contains(It.Key()))
+        {
+            It.Value()->ReleaseHandle();
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void FAnimPreloader::OnRequestFinished(FSoftObjectPath Path)
+{
+    // An asset already in memory completes inside RequestAsyncLoad, so this can still be within the load click
+    QueueBroadcast(Path);
+}
+
+void FAnimPreloader::QueueBroadcast(const FSoftObjectPath& Path)
+{
+    PendingBroadcasts.AddUnique(Path);
+    if (!BroadcastTickerHandle.IsValid())
+    {
+        BroadcastTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAnimPreloader::BroadcastPending));
+    }
+}
+
+bool FAnimPreloader::BroadcastPending(float DeltaTime)
+{
+    BroadcastTickerHandle.Reset();
+    TArray<FSoftObjectPath> Paths = MoveTemp(PendingBroadcasts);
+    for (const FSoftObjectPath& Path : Paths)
+    {
+        // Released or cancelled in the meantime: nobody wants this clip any more
+        if (Handles.Contains(Path))
+        {
+            AnimationPreloaded.Broadcast(Path);
+        }
+    }
+    return false;
+}
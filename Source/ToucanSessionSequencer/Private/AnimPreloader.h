@@ -0,0 +1,47 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Engine/StreamableManager.h"
+
+/**
+ * Streams in the next few unprocessed queue animations while the current clip is being edited,
+ * so the following TryLoad usually resolves from memory. Each preload keeps a strong handle
+ * until its clip has been loaded or drops out of the look-ahead window. Game thread only.
+ */
+class FAnimPreloader
+{
+public:
+    static FAnimPreloader& Get()
+    {
+        static FAnimPreloader S;
+        return S;
+    }
+
+    /** Fires on the game thread once a preloaded animation is in memory, always on a later tick than the
+     *  call that requested it, so listeners never run inside the click that is loading the current clip */
+    DECLARE_MULTICAST_DELEGATE_OneParam(FOnAnimationPreloaded, const FSoftObjectPath& /*Path*/);
+    FOnAnimationPreloaded& OnAnimationPreloaded() { return AnimationPreloaded; }
+
+    void PreloadAfterCurrent(); // call once the current clip has finished loading
+    void Shutdown(); // releases every handle
+
+private:
+    FAnimPreloader();
+
+    void GatherWindow(TArray<FSoftObjectPath>& OutPaths) const; // current item, then the next LookAheadCount unprocessed ones
+    void Prune(); // on queue changes: drop handles for clips that were skipped, processed or removed
+    void OnRequestFinished(FSoftObjectPath Path);
+    void QueueBroadcast(const FSoftObjectPath& Path);
+    bool BroadcastPending(float DeltaTime);
+
+    FStreamableManager Streamable;
+    TMap<FSoftObjectPath, TSharedPtr<FStreamableHandle>> Handles;
+    FDelegateHandle QueueChangedHandle;
+    FOnAnimationPreloaded AnimationPreloaded;
+    TArray<FSoftObjectPath> PendingBroadcasts;
+    FTSTicker::FDelegateHandle BroadcastTickerHandle;
+    int32 LookAheadCount = 1;
+
+    static constexpr const TCHAR* ConfigSection = TEXT("ToucanSequencer");
+    static constexpr const TCHAR* LookAheadCountKey = TEXT("AnimPreloadCount"); // 0 disables preloading
+};
@@ -0,0 +1,101 @@
+#include "CheckpointExistenceCache.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/AssetData.h"
+#include "EditorAssetLibrary.h"
+#include "Misc/PackageName.h"
+
+namespace
+{
+    FName ToPackageName(const FString& AssetPath)
+    {
+        return FName(*FPackageName::ObjectPathToPackageName(AssetPath));
+    }
+}
+
+bool FCheckpointExistenceCache::DoesAssetExist(const FString& AssetPath)
+{
+    if (AssetPath.IsEmpty())
+    {
+        return false;
+    }
+
+    BindToAssetRegistry();
+
+    const FName PackageName = ToPackageName(AssetPath);
+    if (const bool* Cached = ExistsByPackage.Find(PackageName))
+    {
+        return *Cached;
+    }
+
+    const bool bExists = UEditorAssetLibrary::DoesAssetExist(AssetPath);
+
+    // Without registry events there is nothing to invalidate the entry, so only cache while bound
+    if (bBound)
+    {
+        ExistsByPackage.Add(PackageName, bExists);
+    }
+    return bExists;
+}
+
+void FCheckpointExistenceCache::Invalidate()
+{
+    ExistsByPackage.Reset();
+    ++Generation;
+}
+
+void FCheckpointExistenceCache::Shutdown()
+{
+    if (bBound && FModuleManager::Get().IsModuleLoaded("AssetRegistry"))
+    {
+        IAssetRegistry& Registry = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+        Registry.OnAssetAdded().Remove(AddedHandle);
+        Registry.OnAssetRemoved().Remove(RemovedHandle);
+        Registry.OnAssetRenamed().Remove(RenamedHandle);
+    }
+
+    bBound = false;
+    bShutDown = true;
+    Invalidate();
+}
+
+void FCheckpointExistenceCache::BindToAssetRegistry()
+{
+    if (bBound || bShutDown)
+    {
+        return;
+    }
+
+    IAssetRegistry& Registry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    AddedHandle = Registry.OnAssetAdded().AddRaw(this, &FCheckpointExistenceCache::OnAssetAdded);
+    RemovedHandle = Registry.OnAssetRemoved().AddRaw(this, &FCheckpointExistenceCache::OnAssetRemoved);
+    RenamedHandle = Registry.OnAssetRenamed().AddRaw(this, &FCheckpointExistenceCache::OnAssetRenamed);
+    bBound = true;
+}
+
+void FCheckpointExistenceCache::SetCached(FName PackageName, bool bExists)
+{
+    // Packages nobody asked about stay out of the map; the registry scan alone fires thousands of these
+    bool* Cached = ExistsByPackage.Find(PackageName);
+    if (Cached && *Cached != bExists)
+    {
+        *Cached = bExists;
+        ++Generation;
+    }
+}
+
+void FCheckpointExistenceCache::OnAssetAdded(const FAssetData& AssetData)
+{
+    SetCached(AssetData.PackageName, true);
+}
+
+void FCheckpointExistenceCache::OnAssetRemoved(const FAssetData& AssetData)
+{
+    // Store the answer rather than dropping it: the registry may still report the asset during this callback
+    SetCached(AssetData.PackageName, false);
+}
+
+void FCheckpointExistenceCache::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    SetCached(ToPackageName(OldObjectPath), false);
+    SetCached(AssetData.PackageName, true);
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include "CoreMinimal.h"
+
+struct FAssetData;
+
+/**
+ * Remembers whether checkpoint sequences exist, keyed by package name.
+ * The first query for a package asks the asset registry; after that the answer is kept
+ * until an OnAssetAdded/OnAssetRemoved/OnAssetRenamed event touches that package.
+ */
+class FCheckpointExistenceCache
+{
+public:
+    static FCheckpointExistenceCache& Get()
+    {
+        static FCheckpointExistenceCache S;
+        return S;
+    }
+
+    bool DoesAssetExist(const FString& AssetPath);
+    uint32 GetGeneration() const { return Generation; } // changes whenever a cached answer changes
+    void Invalidate();
+    void Shutdown(); // unbinds from the asset registry; call before it goes away
+
+private:
+    FCheckpointExistenceCache() = default;
+
+    void BindToAssetRegistry();
+    void SetCached(FName PackageName, bool bExists);
+    void OnAssetAdded(const FAssetData& AssetData);
+    void OnAssetRemoved(const FAssetData& AssetData);
+    void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+    TMap<FName, bool> ExistsByPackage;
+    uint32 Generation = 0;
+    bool bBound = false;
+    bool bShutDown = false;
+    FDelegateHandle AddedHandle;
+    FDelegateHandle RemovedHandle;
+    FDelegateHandle RenamedHandle;
+};
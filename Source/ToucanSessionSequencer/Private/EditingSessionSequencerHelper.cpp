@@ -28,31 +28,207 @@
 #include "MediaPlateComponent.h"
 #include "Exporters/AnimSeqExportOption.h"
 #include "FileMediaSource.h"
+#include "ImgMediaSource.h"
+#include "MovieSceneMediaSection.h"
 #include "OutputHelper.h"
 #include "Misc/MessageDialog.h"
-#include "Misc/ScopedSlowTask.h"
-#include "Misc/SecureHash.h"
 #include "Containers/Ticker.h"
+#include "Async/Async.h"
 #include "HAL/FileManager.h"
-#include "HAL/PlatformProcess.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "Widgets/Notifications/SNotificationList.h"
 #include "LevelSequencePlayer.h"
 #include "LevelSequenceActor.h"
 #include "MovieSceneSequencePlayer.h"
 #include "Sequencer/MovieSceneControlRigParameterTrack.h"
+#include "Channels/MovieSceneChannelProxy.h"
+#include "Channels/MovieSceneBoolChannel.h"
+#include "Channels/MovieSceneByteChannel.h"
+#include "Channels/MovieSceneDoubleChannel.h"
+#include "Channels/MovieSceneFloatChannel.h"
+#include "Channels/MovieSceneIntegerChannel.h"
 #include "MovieSceneSequenceID.h"
 #include "Animation/AnimationSettings.h"
 #include "ToucanBakedAnimMetadata.h"
+#include "LoadTimings.h"
+#include "MediaProbeCache.h"
+#include "VideoProxyCache.h"
+#include "VideoProxyQueue.h"
 
 #include "SequencerAbstractionBPLibrary.h"
 
 #include "Runtime/Launch/Resources/Version.h"
 
+DECLARE_CYCLE_STAT(TEXT("Load next animation"), STAT_ToucanSequencer_LoadNextAnimation, STATGROUP_ToucanSequencer);
+DECLARE_CYCLE_STAT(TEXT("Load checkpoint sequence"), STAT_ToucanSequencer_LoadCheckpoint, STATGROUP_ToucanSequencer);
+DECLARE_CYCLE_STAT(TEXT("Open sequence editor"), STAT_ToucanSequencer_OpenEditor, STATGROUP_ToucanSequencer);
+DECLARE_CYCLE_STAT(TEXT("Remove old rig"), STAT_ToucanSequencer_RemoveRig, STATGROUP_ToucanSequencer);
+DECLARE_CYCLE_STAT(TEXT("Spawn or find mesh actor"), STAT_ToucanSequencer_SpawnMeshActor, STATGROUP_ToucanSequencer);
+DECLARE_CYCLE_STAT(TEXT("Find mesh binding"), STAT_ToucanSequencer_FindBinding, STATGROUP_ToucanSequencer);
+DECLARE_CYCLE_STAT(TEXT("Add animation track"), STAT_ToucanSequencer_AddAnimationTrack, STATGROUP_ToucanSequencer);
+DECLARE_CYCLE_STAT(TEXT("Add rig"), STAT_ToucanSequencer_AddRig, STATGROUP_ToucanSequencer);
+DECLARE_CYCLE_STAT(TEXT("Force evaluate"), STAT_ToucanSequencer_ForceEvaluate, STATGROUP_ToucanSequencer);
+DECLARE_CYCLE_STAT(TEXT("Prepare next clip"), STAT_ToucanSequencer_PrepareNext, STATGROUP_ToucanSequencer);
+
 TWeakObjectPtr<ULevelSequence> FEditingSessionSequencerHelper::ActiveSequence;
 TWeakObjectPtr<USkeletalMeshComponent> FEditingSessionSequencerHelper::ActiveSkeletalMeshComponent;
 TWeakObjectPtr<UControlRig> FEditingSessionSequencerHelper::ActiveRig;
 
+// Channel defaults of one rig section as AddRigToSequence created it, per channel type in proxy order
+struct FRigSectionDefaults
+{
+    TArray<TOptional<float>> Floats;
+    TArray<TOptional<double>> Doubles;
+    TArray<TOptional<bool>> Bools;
+    TArray<TOptional<int32>> Integers;
+    TArray<TOptional<uint8>> Bytes;
+};
+
+template <typename ChannelType, typename ValueType>
+void CaptureChannelDefaults(UMovieSceneSection& Section, TArray<TOptional<ValueType>>& OutDefaults)
+{
+    for (const ChannelType* Channel : Section.GetChannelProxy().GetChannels<ChannelType>())
+    {
+        OutDefaults.Add(Channel ? Channel->GetDefault() : TOptional<ValueType>());
+    }
+}
+
+template <typename ChannelType, typename ValueType>
+bool ChannelCountMatches(UMovieSceneSection& Section, const TArray<TOptional<ValueType>>& Defaults)
+{
+    return Section.GetChannelProxy().GetChannels<ChannelType>().Num() == Defaults.Num();
+}
+
+template <typename ChannelType, typename ValueType>
+void RestoreChannelDefaults(UMovieSceneSection& Section, const TArray<TOptional<ValueType>>& Defaults)
+{
+    const TArrayView<ChannelType* const> Channels = Section.GetChannelProxy().GetChannels<ChannelType>();
+    for (int32 Index = 0; Index < Channels.Num(); ++Index)
+    {
+        if (!Channels[Index])
+            continue;
+        if (Defaults[Index].IsSet())
+            Channels[Index]->SetDefault(Defaults[Index].GetValue());
+        else
+            Channels[Index]->RemoveDefault();
+    }
+}
+
+// Two editing sequences used in turn: one is open in Sequencer while the other is built up with the next clip
+struct FSequenceSlot
+{
+    TWeakObjectPtr<ULevelSequence> Sequence;
+    TWeakObjectPtr<USkeletalMesh> RigTrackMesh; // mesh the slot's rig track was built for
+    TArray<FRigSectionDefaults> RigTrackDefaults; // per section of that track, as it was created
+
+    // Set by PrepareNextAnimation; the clip part is consumed by LoadNextAnimation, the video part by LoadVideoForCurrentSequence
+    TWeakObjectPtr<UAnimSequence> PreparedAnimation;
+    TWeakObjectPtr<USkeletalMesh> PreparedMesh;
+    TWeakObjectPtr<UObject> PreparedRig;
+    bool bPreparedRigTrack = false; // false when the rig track can only be created once the sequence is open
+    FString PreparedVideoPath;
+    FString PreparedPlaybackPath;
+    TWeakObjectPtr<UMovieSceneSection> PreparedMediaSection;
+
+    bool IsPreparedFor(const UAnimSequence* Animation, const USkeletalMesh* Mesh, const UObject* Rig) const
+    {
+        return Animation && PreparedAnimation.Get() == Animation && PreparedMesh.Get() == Mesh && PreparedRig.Get() == Rig;
+    }
+
+    void ResetPrepared()
+    {
+        PreparedAnimation = nullptr;
+        PreparedMesh = nullptr;
+        PreparedRig = nullptr;
+        bPreparedRigTrack = false;
+        ResetPreparedVideo();
+    }
+
+    void ResetPreparedVideo()
+    {
+        PreparedVideoPath.Reset();
+        PreparedPlaybackPath.Reset();
+        PreparedMediaSection = nullptr;
+    }
+};
+
+static constexpr int32 NumSequenceSlots = 2;
+static FSequenceSlot SequenceSlots[NumSequenceSlots];
+static const TCHAR* const SequenceSlotAssetNames[NumSequenceSlots] = { TEXT("EditingSession_Sequence"), TEXT("EditingSession_Sequence_B") };
+
+FSequenceSlot* FindSequenceSlot(const ULevelSequence* Sequence)
+{
+    for (FSequenceSlot& Slot : SequenceSlots)
+    {
+        if (Sequence && Slot.Sequence.Get() == Sequence)
+        {
+            return &Slot;
+        }
+    }
+    return nullptr;
+}
+
+// The one Control Rig track AddRigToSequence puts in a sequence; null if there is none or more than one
+UMovieSceneControlRigParameterTrack* FindSingleRigTrack(const UMovieScene* MovieScene)
+{
+    UMovieSceneControlRigParameterTrack* RigTrack = nullptr;
+    for (const FMovieSceneBinding& Binding : MovieScene->GetBindings())
+    {
+        for (UMovieSceneTrack* Track : Binding.GetTracks())
+        {
+            if (UMovieSceneControlRigParameterTrack* Candidate = Cast<UMovieSceneControlRigParameterTrack>(Track))
+            {
+                if (RigTrack)
+                    return nullptr;
+                RigTrack = Candidate;
+            }
+        }
+    }
+    return RigTrack;
+}
+
+// Called right after AddRigToSequence: what the slot needs to hand the track to the next clip in its fresh state
+void RememberNewRigTrack(FSequenceSlot& Slot, USkeletalMesh* Mesh)
+{
+    Slot.RigTrackMesh = Mesh;
+    Slot.RigTrackDefaults.Reset();
+
+    ULevelSequence* Sequence = Slot.Sequence.Get();
+    UMovieScene* MovieScene = Sequence ? Sequence->GetMovieScene() : nullptr;
+    UMovieSceneControlRigParameterTrack* RigTrack = MovieScene ? FindSingleRigTrack(MovieScene) : nullptr;
+    if (!RigTrack)
+    {
+        Slot.RigTrackMesh = nullptr; // nothing to reuse
+        return;
+    }
+
+    for (UMovieSceneSection* Section : RigTrack->GetAllSections())
+    {
+        FRigSectionDefaults& Defaults = Slot.RigTrackDefaults.AddDefaulted_GetRef();
+        if (!Section)
+            continue;
+        CaptureChannelDefaults<FMovieSceneFloatChannel>(*Section, Defaults.Floats);
+        CaptureChannelDefaults<FMovieSceneDoubleChannel>(*Section, Defaults.Doubles);
+        CaptureChannelDefaults<FMovieSceneBoolChannel>(*Section, Defaults.Bools);
+        CaptureChannelDefaults<FMovieSceneIntegerChannel>(*Section, Defaults.Integers);
+        CaptureChannelDefaults<FMovieSceneByteChannel>(*Section, Defaults.Bytes);
+    }
+}
+
+// The slot that is not being edited; with neither slot active (fresh session, checkpoint open) a prepared slot wins
+int32 GetStandbySlotIndex()
+{
+    const ULevelSequence* Active = FEditingSessionSequencerHelper::GetActiveSequence();
+    for (int32 Index = 0; Index < NumSequenceSlots; ++Index)
+    {
+        if (Active && SequenceSlots[Index].Sequence.Get() == Active)
+        {
+            return 1 - Index;
+        }
+    }
+    return SequenceSlots[1].PreparedAnimation.IsValid() ? 1 : 0;
+}
+
 void setLooping(ULevelSequence* LevelSequence)
 {
     if (UAssetEditorSubsystem* EditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
@@ -96,6 +272,80 @@ void NotifyActiveSequencer(ULevelSequence* LevelSequence, EMovieSceneDataChangeT
     }
 }
 
+// The session's actors, so loading a clip does not walk every actor in the level.
+// Dropped on map change and when either actor is deleted; a stale entry is also rejected by IsCachedActorUsable.
+static TWeakObjectPtr<ASkeletalMeshActor> CachedMeshActor;
+static TWeakObjectPtr<AMediaPlate> CachedMediaPlate;
+static FDelegateHandle SessionMapChangedHandle;
+static FDelegateHandle SessionActorDeletedHandle;
+
+void OnSessionActorDeleted(AActor* Actor)
+{
+    if (!Actor || (Actor != CachedMeshActor.Get() && Actor != CachedMediaPlate.Get()))
+    {
+        return;
+    }
+
+    if (Actor == CachedMeshActor.Get())
+    {
+        CachedMeshActor = nullptr;
+    }
+    if (Actor == CachedMediaPlate.Get())
+    {
+        CachedMediaPlate = nullptr;
+    }
+
+    // Prepared sequences are bound to these actors; the next clip has to be built against their replacements
+    for (FSequenceSlot& Slot : SequenceSlots)
+    {
+        Slot.ResetPrepared();
+    }
+}
+
+void OnSessionMapChanged(uint32 /*MapChangeFlags*/)
+{
+    CachedMeshActor = nullptr;
+    CachedMediaPlate = nullptr;
+
+    // Prepared sequences are bound to actors of the old level
+    for (FSequenceSlot& Slot : SequenceSlots)
+    {
+        Slot.ResetPrepared();
+    }
+}
+
+void WatchSessionActors()
+{
+    if (!SessionMapChangedHandle.IsValid())
+    {
+        SessionMapChangedHandle = FEditorDelegates::MapChange.AddStatic(&OnSessionMapChanged);
+    }
+    if (!SessionActorDeletedHandle.IsValid() && GEngine)
+    {
+        SessionActorDeletedHandle = GEngine->OnLevelActorDeleted().AddStatic(&OnSessionActorDeleted);
+    }
+}
+
+void StopWatchingSessionActors()
+{
+    FEditorDelegates::MapChange.Remove(SessionMapChangedHandle);
+    SessionMapChangedHandle.Reset();
+    if (GEngine)
+    {
+        GEngine->OnLevelActorDeleted().Remove(SessionActorDeletedHandle);
+    }
+    SessionActorDeletedHandle.Reset();
+    CachedMeshActor = nullptr;
+    CachedMediaPlate = nullptr;
+}
+
+template <typename ActorType>
+ActorType* GetUsableCachedActor(const TWeakObjectPtr<ActorType>& Cached, const UWorld* World)
+{
+    ActorType* Actor = Cached.Get();
+    return (Actor && IsValid(Actor) && Actor->GetWorld() == World) ? Actor : nullptr;
+}
+
 AMediaPlate* FindOrSpawnMediaPlate(UWorld* World)
 {
     if (!World)
@@ -103,6 +353,12 @@ AMediaPlate* FindOrSpawnMediaPlate(UWorld* World)
         return nullptr;
     }
 
+    WatchSessionActors();
+    if (AMediaPlate* Cached = GetUsableCachedActor(CachedMediaPlate, World))
+    {
+        return Cached;
+    }
+
     AMediaPlate* FirstMediaPlate = nullptr;
     for (TActorIterator<AMediaPlate> It(World); It; ++It)
     {
@@ -120,6 +376,7 @@ AMediaPlate* FindOrSpawnMediaPlate(UWorld* World)
         if (ExistingMediaPlate->GetActorLabel() == TEXT("ToucanSession_MediaPlate"))
         {
             UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Reusing ToucanSession_MediaPlate."));
+            CachedMediaPlate = ExistingMediaPlate;
             return ExistingMediaPlate;
         }
     }
@@ -127,16 +384,24 @@ AMediaPlate* FindOrSpawnMediaPlate(UWorld* World)
     if (FirstMediaPlate)
     {
         UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Reusing existing MediaPlate: %s"), *FirstMediaPlate->GetName());
+        CachedMediaPlate = FirstMediaPlate;
         return FirstMediaPlate;
     }
 
     FVector SpawnLocation(0.0f, 0.0f, 150.0f);
-    for (TActorIterator<ASkeletalMeshActor> It(World); It; ++It)
+    if (const ASkeletalMeshActor* MeshActor = GetUsableCachedActor(CachedMeshActor, World))
     {
-        if (It->GetName() == TEXT("EditingSession_SkeletalMeshActor"))
+        SpawnLocation = MeshActor->GetActorLocation() + FVector(0.0f, -250.0f, 120.0f);
+    }
+    else
+    {
+        for (TActorIterator<ASkeletalMeshActor> It(World); It; ++It)
         {
-            SpawnLocation = It->GetActorLocation() + FVector(0.0f, -250.0f, 120.0f);
-            break;
+            if (It->GetName() == TEXT("EditingSession_SkeletalMeshActor"))
+            {
+                SpawnLocation = It->GetActorLocation() + FVector(0.0f, -250.0f, 120.0f);
+                break;
+            }
         }
     }
 
@@ -150,10 +415,11 @@ AMediaPlate* FindOrSpawnMediaPlate(UWorld* World)
         UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Spawned ToucanSession_MediaPlate."));
     }
 
+    CachedMediaPlate = MediaPlate;
     return MediaPlate;
 }
 
-AMediaPlate* AssignMediaSourceToMediaPlate(UFileMediaSource* MediaSource)
+AMediaPlate* AssignMediaSourceToMediaPlate(UMediaSource* MediaSource)
 {
     if (!MediaSource || !GEditor)
     {
@@ -187,199 +453,294 @@ enum class EFfprobeTimecodeResult
     NoTimecode
 };
 
-bool TryGetVideoResolutionWithFfprobe(const FString& VideoFilePath, FIntPoint& OutResolution, bool& bOutMissingExecutable)
+// Image-sequence proxies are directories of frames; everything else plays as a single file
+UMediaSource* CreatePlaybackMediaSource(UObject* Outer, const FString& PlaybackPath, const FString& OriginalVideoFilePath)
 {
-    bOutMissingExecutable = false;
+    if (FPaths::DirectoryExists(PlaybackPath))
+    {
+        UImgMediaSource* ImgSource = NewObject<UImgMediaSource>(Outer, NAME_None, RF_Transactional);
+        ImgSource->SetSequencePath(PlaybackPath);
+
+        // Frames carry no timing of their own, so play them at the source clip's rate
+        FMediaProbeInfo ProbeInfo;
+        if (FMediaProbeCache::Get().TryGetCached(OriginalVideoFilePath, ProbeInfo) && ProbeInfo.FrameRate.IsValid())
+        {
+            ImgSource->FrameRateOverride = ProbeInfo.FrameRate;
+        }
+        return ImgSource;
+    }
+
+    UFileMediaSource* FileSource = NewObject<UFileMediaSource>(Outer, NAME_None, RF_Transactional);
+    FileSource->SetFilePath(PlaybackPath);
+    return FileSource;
+}
+
+// The media section currently playing an original video while its proxy encodes
+struct FPendingProxySwap
+{
+    TWeakObjectPtr<ULevelSequence> Sequence;
+    TWeakObjectPtr<UMovieSceneSection> Section;
+    FString ProxyPath;
+};
 
-    FString StdOut;
-    FString StdErr;
-    int32 ReturnCode = 0;
-    const FString Args = FString::Printf(
-        TEXT("-v error -select_streams v:0 -show_entries stream=width,height -of csv=p=0:s=x \"%s\""),
-        *VideoFilePath);
+static FPendingProxySwap PendingProxySwap;
+static FDelegateHandle ProxyFinishedHandle;
 
-    if (!FPlatformProcess::ExecProcess(TEXT("ffprobe"), *Args, &ReturnCode, &StdOut, &StdErr))
+void OnVideoProxyFinished(const FString& SourcePath, const FString& ProxyPath, bool bSuccess)
+{
+    if (PendingProxySwap.ProxyPath != ProxyPath)
     {
-        bOutMissingExecutable = true;
-        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Video proxy skipped: ffprobe was not found on PATH."));
-        return false;
+        return;
     }
 
-    if (ReturnCode != 0)
+    ULevelSequence* Sequence = PendingProxySwap.Sequence.Get();
+    UMovieSceneSection* Section = PendingProxySwap.Section.Get();
+    PendingProxySwap = FPendingProxySwap();
+    if (!bSuccess || !Sequence || !Section || Sequence != FEditingSessionSequencerHelper::GetActiveSequence())
     {
-        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Video proxy skipped: ffprobe failed with exit code %d: %s"), ReturnCode, *StdErr);
-        return false;
+        return;
     }
 
-    FString Line = StdOut;
-    Line.TrimStartAndEndInline();
-
-    FString WidthText;
-    FString HeightText;
-    if (!Line.Split(TEXT("x"), &WidthText, &HeightText))
+    // A new source rather than an edited one, since an image-sequence proxy needs a different source class
+    FVideoProxyCache::Get().MarkInUse(ProxyPath);
+    UMediaSource* ProxySource = CreatePlaybackMediaSource(Sequence, ProxyPath, SourcePath);
+    UMovieSceneMediaSection* MediaSection = Cast<UMovieSceneMediaSection>(Section);
+    if (MediaSection && MediaSection->GetMediaSource())
     {
-        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Video proxy skipped: could not parse ffprobe resolution output: %s"), *StdOut);
-        return false;
+        MediaSection->Modify();
+        MediaSection->SetMediaSource(ProxySource);
     }
-
-    OutResolution.X = FCString::Atoi(*WidthText);
-    OutResolution.Y = FCString::Atoi(*HeightText);
-    return OutResolution.X > 0 && OutResolution.Y > 0;
+    AssignMediaSourceToMediaPlate(ProxySource);
+    NotifyActiveSequencer(Sequence, EMovieSceneDataChangeType::TrackValueChanged);
+    UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Switched video playback to review proxy: %s (source: %s)"), *ProxyPath, *SourcePath);
 }
 
-FString GetCachedVideoProxyPath(const FString& VideoFilePath)
+// Returns the path to play right now; OutPendingProxyPath is set when a proxy is still being encoded
+FString ResolveVideoPathForEditorPlayback(const FString& OriginalVideoFilePath, FString& OutPendingProxyPath)
 {
-    const FString ProxyDir = FPaths::ProjectSavedDir() / TEXT("ToucanSessionSequencer/VideoProxies");
-    IFileManager::Get().MakeDirectory(*ProxyDir, true);
-
-    const FFileStatData StatData = IFileManager::Get().GetStatData(*VideoFilePath);
-    const FString HashInput = FString::Printf(
-        TEXT("%s|%lld|%s"),
-        *VideoFilePath,
-        StatData.FileSize,
-        *StatData.ModificationTime.ToString());
-    const FString Hash = FMD5::HashAnsiString(*HashInput).Left(10);
-    const FString CleanBaseName = FPaths::MakeValidFileName(FPaths::GetBaseFilename(VideoFilePath));
-    return ProxyDir / FString::Printf(TEXT("%s_%s_1080.mp4"), *CleanBaseName, *Hash);
-}
+    OutPendingProxyPath.Reset();
 
-bool TryCreateVideoProxyWithFfmpeg(const FString& SourcePath, const FString& ProxyPath, const FIntPoint& SourceResolution, bool& bOutMissingExecutable)
-{
-    bOutMissingExecutable = false;
+    FMediaProbeInfo ProbeInfo;
+    if (FMediaProbeCache::Get().Probe(OriginalVideoFilePath, ProbeInfo) != EMediaProbeResult::Success)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Video proxy skipped: could not probe %s"), *OriginalVideoFilePath);
+        return OriginalVideoFilePath;
+    }
 
-    FNotificationInfo Info(FText::FromString(TEXT("Creating 1080 video proxy...")));
-    Info.bFireAndForget = false;
-    Info.FadeOutDuration = 0.5f;
-    Info.ExpireDuration = 2.0f;
-    TSharedPtr<SNotificationItem> Notification = FSlateNotificationManager::Get().AddNotification(Info);
-    if (Notification.IsValid())
+    const FIntPoint SourceResolution = ProbeInfo.Resolution;
+    const FVideoProxyProfile& Profile = FVideoProxyProfiles::Get().GetActive();
+    if (!Profile.NeedsProxy(SourceResolution))
     {
-        Notification->SetCompletionState(SNotificationItem::CS_Pending);
+        UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Video is already editor-friendly resolution: %dx%d"), SourceResolution.X, SourceResolution.Y);
+        return OriginalVideoFilePath;
     }
 
-    FScopedSlowTask SlowTask(1.0f, FText::FromString(TEXT("Creating 1080 review proxy...")));
-    SlowTask.MakeDialog(false);
-    SlowTask.EnterProgressFrame(1.0f);
+    const FString ProxyPath = FVideoProxyQueue::GetCachedVideoProxyPath(OriginalVideoFilePath, Profile);
+    if (FVideoProxyCache::ProxyExists(ProxyPath))
+    {
+        UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Using cached %s review proxy: %s"), *Profile.Name, *ProxyPath);
+        FVideoProxyCache::Get().MarkInUse(ProxyPath);
+        return ProxyPath;
+    }
 
-    FString StdOut;
-    FString StdErr;
-    int32 ReturnCode = 0;
-    const FString Scale = SourceResolution.X >= SourceResolution.Y ? TEXT("-2:1080") : TEXT("1080:-2");
-    const FString Args = FString::Printf(
-        TEXT("-y -hide_banner -loglevel error -i \"%s\" -vf scale=%s -c:v libx264 -preset ultrafast -crf 20 -g 1 -pix_fmt yuv420p -an \"%s\""),
-        *SourcePath,
-        *Scale,
-        *ProxyPath);
+    UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Video is %dx%d; creating %s review proxy in the background."), SourceResolution.X, SourceResolution.Y, *Profile.Name);
+    FVideoProxyQueue::FRequest Request;
+    Request.SourcePath = OriginalVideoFilePath;
+    Request.ProxyPath = ProxyPath;
+    Request.SourceResolution = SourceResolution;
+    Request.DurationSeconds = ProbeInfo.DurationSeconds;
+    Request.Profile = Profile;
+    Request.Priority = FVideoProxyQueue::EPriority::Foreground;
+    FVideoProxyQueue::Get().Enqueue(Request);
 
-    if (!FPlatformProcess::ExecProcess(TEXT("ffmpeg"), *Args, &ReturnCode, &StdOut, &StdErr))
+    OutPendingProxyPath = ProxyPath;
+    return OriginalVideoFilePath;
+}
+
+// Like ResolveVideoPathForEditorPlayback, but never probes or queues work; used when building the standby sequence
+FString PeekVideoPathForEditorPlayback(const FString& OriginalVideoFilePath)
+{
+    FMediaProbeInfo ProbeInfo;
+    const FVideoProxyProfile& Profile = FVideoProxyProfiles::Get().GetActive();
+    if (FMediaProbeCache::Get().TryGetCached(OriginalVideoFilePath, ProbeInfo) && Profile.NeedsProxy(ProbeInfo.Resolution))
     {
-        bOutMissingExecutable = true;
-        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Video proxy skipped: ffmpeg was not found on PATH."));
-        if (Notification.IsValid())
+        const FString ProxyPath = FVideoProxyQueue::GetCachedVideoProxyPath(OriginalVideoFilePath, Profile);
+        if (FVideoProxyCache::ProxyExists(ProxyPath))
         {
-            Notification->SetText(FText::FromString(TEXT("ffmpeg not found; using original video.")));
-            Notification->SetCompletionState(SNotificationItem::CS_Fail);
-            Notification->ExpireAndFadeout();
+            return ProxyPath;
         }
-        return false;
     }
+    return OriginalVideoFilePath;
+}
 
-    if (ReturnCode != 0 || !FPaths::FileExists(ProxyPath))
+// Replaces whatever media the sequence plays on the MediaPlate with one section for MediaSource
+UMovieSceneSection* AddMediaPlateVideoSection(ULevelSequence* Sequence, AMediaPlate* MediaPlate, UMediaSource* MediaSource)
+{
+    UMovieScene* MovieScene = Sequence ? Sequence->GetMovieScene() : nullptr;
+    if (!MovieScene)
     {
-        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Video proxy creation failed with exit code %d: %s"), ReturnCode, *StdErr);
-        IFileManager::Get().Delete(*ProxyPath, false, true, true);
-        if (Notification.IsValid())
-        {
-            Notification->SetText(FText::FromString(TEXT("Video proxy creation failed; using original video.")));
-            Notification->SetCompletionState(SNotificationItem::CS_Fail);
-            Notification->ExpireAndFadeout();
-        }
-        return false;
+        return nullptr;
+    }
+
+    FSequenceOpenResult BindingResult;
+    const FGuid MediaPlateBindingID = USequencerAbstractionBPLibrary::FindOrCreatePossessableBinding(
+        Sequence,
+        MediaPlate,
+        BindingResult);
+    if (!BindingResult.bSuccess || !MediaPlateBindingID.IsValid())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Cannot load video: failed to bind MediaPlate to sequence: %s"), *BindingResult.Error);
+        return nullptr;
     }
 
-    UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Created 1080 review proxy: %s"), *ProxyPath);
-    if (Notification.IsValid())
+    FSequenceOpenResult RemoveMediaTracksResult;
+    const int32 RemovedMediaTracks = USequencerAbstractionBPLibrary::RemoveMediaTracksFromBinding(
+        Sequence,
+        MediaPlateBindingID,
+        RemoveMediaTracksResult);
+    if (!RemoveMediaTracksResult.bSuccess)
     {
-        Notification->SetText(FText::FromString(TEXT("1080 video proxy ready.")));
-        Notification->SetCompletionState(SNotificationItem::CS_Success);
-        Notification->ExpireAndFadeout();
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Failed to clear old MediaPlate media tracks: %s"), *RemoveMediaTracksResult.Error);
     }
-    return true;
+    else if (RemovedMediaTracks > 0)
+    {
+        UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Removed %d old MediaPlate media track(s)."), RemovedMediaTracks);
+    }
+
+    const FFrameNumber InitialFrame = MovieScene->GetPlaybackRange().GetLowerBoundValue();
+    FSequenceOpenResult MediaSectionResult;
+    UMovieSceneSection* MediaSection = USequencerAbstractionBPLibrary::AddMediaSourceProxySectionToBinding(
+        Sequence,
+        MediaPlateBindingID,
+        MediaSource,
+        InitialFrame.Value,
+        0,
+        MediaSectionResult);
+    if (!MediaSectionResult.bSuccess || !MediaSection)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Cannot load video: failed to create MediaPlate media section: %s"), *MediaSectionResult.Error);
+        return nullptr;
+    }
+
+    return MediaSection;
 }
 
-FString ResolveVideoPathForEditorPlayback(const FString& OriginalVideoFilePath)
+// Usually a cache hit: ResolveVideoPathForEditorPlayback probed the same file when the video was loaded
+EFfprobeTimecodeResult TryReadVideoTimecodeWithFfprobe(const FString& VideoFilePath, FTimecode& OutTimecode)
 {
-    FIntPoint SourceResolution;
-    bool bMissingFfprobe = false;
-    if (!TryGetVideoResolutionWithFfprobe(OriginalVideoFilePath, SourceResolution, bMissingFfprobe))
+    FMediaProbeInfo ProbeInfo;
+    const EMediaProbeResult ProbeResult = FMediaProbeCache::Get().Probe(VideoFilePath, ProbeInfo);
+    if (ProbeResult == EMediaProbeResult::MissingExecutable)
     {
-        return OriginalVideoFilePath;
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] ffprobe timecode fallback failed: ffprobe was not found on PATH."));
+        return EFfprobeTimecodeResult::MissingExecutable;
     }
 
-    if (SourceResolution.X <= 1920 && SourceResolution.Y <= 1080)
+    if (ProbeResult != EMediaProbeResult::Success)
     {
-        UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Video is already editor-friendly resolution: %dx%d"), SourceResolution.X, SourceResolution.Y);
-        return OriginalVideoFilePath;
+        return EFfprobeTimecodeResult::NoTimecode;
     }
 
-    const FString ProxyPath = GetCachedVideoProxyPath(OriginalVideoFilePath);
-    if (FPaths::FileExists(ProxyPath))
+    const TOptional<FTimecode> ParsedTimecode = ProbeInfo.GetTimecode();
+    if (ParsedTimecode.IsSet())
     {
-        UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Using cached 1080 review proxy: %s"), *ProxyPath);
-        return ProxyPath;
+        OutTimecode = ParsedTimecode.GetValue();
+        return EFfprobeTimecodeResult::Success;
     }
 
-    UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Video is %dx%d; creating 1080 review proxy."), SourceResolution.X, SourceResolution.Y);
-    bool bMissingFfmpeg = false;
-    if (TryCreateVideoProxyWithFfmpeg(OriginalVideoFilePath, ProxyPath, SourceResolution, bMissingFfmpeg))
+    UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] ffprobe did not return a parseable timecode: '%s'"), *ProbeInfo.Timecode);
+    return EFfprobeTimecodeResult::NoTimecode;
+}
+
+// One snap attempt, shared by the player poll and the ffprobe worker; whichever finds a timecode first snaps the section
+struct FTimecodeSnapRequest
+{
+    TWeakObjectPtr<ULevelSequence> Sequence;
+    TWeakObjectPtr<UMovieSceneSection> Section;
+    TSharedPtr<SNotificationItem> Notification;
+    FTSTicker::FDelegateHandle TickerHandle;
+    double StartSeconds = 0.0;
+    EFfprobeTimecodeResult ProbeResult = EFfprobeTimecodeResult::NoTimecode;
+    bool bProbeFinished = false;
+    bool bDone = false;
+};
+
+constexpr double TimecodeWaitSeconds = 2.0;
+
+void FinishTimecodeSnap(FTimecodeSnapRequest& Request, const TCHAR* Message, bool bSuccess)
+{
+    Request.bDone = true;
+    if (Request.Notification.IsValid())
     {
-        return ProxyPath;
+        Request.Notification->SetText(FText::FromString(Message));
+        Request.Notification->SetCompletionState(bSuccess ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+        Request.Notification->ExpireAndFadeout();
     }
-
-    return OriginalVideoFilePath;
 }
 
-EFfprobeTimecodeResult TryReadVideoTimecodeWithFfprobe(const FString& VideoFilePath, FTimecode& OutTimecode)
+void SnapSectionToFoundTimecode(FTimecodeSnapRequest& Request, const FTimecode* ProbedTimecode, const TCHAR* Message)
 {
-    FString StdOut;
-    FString StdErr;
-    int32 ReturnCode = 0;
-    const FString Args = FString::Printf(
-        TEXT("-v error -select_streams v:0 -show_entries stream_tags=timecode -of default=noprint_wrappers=1:nokey=1 \"%s\""),
-        *VideoFilePath);
+    ULevelSequence* PinnedSequence = Request.Sequence.Get();
+    UMovieSceneSection* PinnedSection = Request.Section.Get();
+    if (!PinnedSequence || !PinnedSection)
+    {
+        FinishTimecodeSnap(Request, TEXT("Video timecode check failed."), false);
+        return;
+    }
 
-    if (!FPlatformProcess::ExecProcess(TEXT("ffprobe"), *Args, &ReturnCode, &StdOut, &StdErr))
+    if (ProbedTimecode)
     {
-        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] ffprobe timecode fallback failed: ffprobe was not found on PATH."));
-        return EFfprobeTimecodeResult::MissingExecutable;
+        PinnedSection->TimecodeSource = FMovieSceneTimecodeSource(*ProbedTimecode);
     }
+    UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Video source timecode found: %s (%s)"),
+        *PinnedSection->TimecodeSource.Timecode.ToString(), ProbedTimecode ? TEXT("ffprobe") : TEXT("media player"));
 
-    if (ReturnCode != 0)
+    FSequenceOpenResult SnapResult;
+    USequencerAbstractionBPLibrary::SnapSectionToSourceTimecode(PinnedSequence, PinnedSection, false, SnapResult);
+    if (!SnapResult.bSuccess)
     {
-        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] ffprobe timecode fallback failed with exit code %d: %s"), ReturnCode, *StdErr);
-        return EFfprobeTimecodeResult::NoTimecode;
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Failed to snap video section using SequencerAbstraction: %s"), *SnapResult.Error);
     }
+    FinishTimecodeSnap(Request, Message, true);
+}
 
-    TArray<FString> Lines;
-    StdOut.ParseIntoArrayLines(Lines, true);
-    for (FString Line : Lines)
+void FailTimecodeSnap(FTimecodeSnapRequest& Request)
+{
+    if (Request.ProbeResult == EFfprobeTimecodeResult::MissingExecutable)
     {
-        Line.TrimStartAndEndInline();
-        if (Line.IsEmpty())
-        {
-            continue;
-        }
+        FinishTimecodeSnap(Request, TEXT("ffprobe not found on PATH; video timecode fallback skipped."), false);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] No video source timecode from the media player or ffprobe."));
+        FinishTimecodeSnap(Request, TEXT("No video timecode found within 2 seconds."), false);
+    }
+}
 
-        const TOptional<FTimecode> ParsedTimecode = FTimecode::ParseTimecode(*Line);
-        if (ParsedTimecode.IsSet())
-        {
-            OutTimecode = ParsedTimecode.GetValue();
-            return EFfprobeTimecodeResult::Success;
-        }
+void OnTimecodeProbeFinished(const TSharedRef<FTimecodeSnapRequest>& Request, EFfprobeTimecodeResult Result, const FTimecode& Timecode)
+{
+    if (Request->bDone)
+    {
+        return; // the player answered first
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] ffprobe did not return a parseable timecode. Output: %s"), *StdOut);
-    return EFfprobeTimecodeResult::NoTimecode;
+    Request->bProbeFinished = true;
+    Request->ProbeResult = Result;
+    const bool bTimedOut = FPlatformTime::Seconds() - Request->StartSeconds >= TimecodeWaitSeconds;
+    if (Result != EFfprobeTimecodeResult::Success && !bTimedOut)
+    {
+        return; // keep waiting on the player until the timeout
+    }
+
+    FTSTicker::GetCoreTicker().RemoveTicker(Request->TickerHandle);
+    if (Result == EFfprobeTimecodeResult::Success)
+    {
+        SnapSectionToFoundTimecode(*Request, &Timecode, TEXT("Video timecode loaded with ffprobe."));
+    }
+    else
+    {
+        FailTimecodeSnap(*Request);
+    }
 }
 
 void WaitForMediaSectionTimecodeAndSnap(ULevelSequence* LevelSequence, UMovieScene* MovieScene, UMovieSceneSection* Section, const FString& VideoFilePath)
@@ -389,99 +750,69 @@ void WaitForMediaSectionTimecodeAndSnap(ULevelSequence* LevelSequence, UMovieSce
         return;
     }
 
+    TSharedRef<FTimecodeSnapRequest> Request = MakeShared<FTimecodeSnapRequest>();
+    Request->Sequence = LevelSequence;
+    Request->Section = Section;
+    Request->StartSeconds = FPlatformTime::Seconds();
+
+    // Choosing the playback proxy already probed this file, so this is usually answered without waiting at all
+    FMediaProbeInfo ProbeInfo;
+    if (FMediaProbeCache::Get().TryGetCached(VideoFilePath, ProbeInfo))
+    {
+        const TOptional<FTimecode> CachedTimecode = ProbeInfo.GetTimecode();
+        if (CachedTimecode.IsSet())
+        {
+            SnapSectionToFoundTimecode(*Request, &CachedTimecode.GetValue(), TEXT("Video timecode loaded."));
+            return;
+        }
+    }
+
     FNotificationInfo Info(FText::FromString(TEXT("Trying to read video timecode...")));
     Info.bFireAndForget = false;
     Info.FadeOutDuration = 0.5f;
     Info.ExpireDuration = 2.0f;
-    TSharedPtr<SNotificationItem> Notification = FSlateNotificationManager::Get().AddNotification(Info);
-    if (Notification.IsValid())
+    Request->Notification = FSlateNotificationManager::Get().AddNotification(Info);
+    if (Request->Notification.IsValid())
     {
-        Notification->SetCompletionState(SNotificationItem::CS_Pending);
+        Request->Notification->SetCompletionState(SNotificationItem::CS_Pending);
     }
 
-    TWeakObjectPtr<ULevelSequence> WeakSequence(LevelSequence);
-    TWeakObjectPtr<UMovieScene> WeakMovieScene(MovieScene);
-    TWeakObjectPtr<UMovieSceneSection> WeakSection(Section);
-    const double StartSeconds = FPlatformTime::Seconds();
-    constexpr double TimeoutSeconds = 2.0;
+    // Race the player's timecode against ffprobe on a worker instead of trying them one after the other
+    Async(EAsyncExecution::ThreadPool, [Request, VideoFilePath]()
+    {
+        FTimecode ProbedTimecode;
+        const EFfprobeTimecodeResult Result = TryReadVideoTimecodeWithFfprobe(VideoFilePath, ProbedTimecode);
+        AsyncTask(ENamedThreads::GameThread, [Request, Result, ProbedTimecode]()
+        {
+            OnTimecodeProbeFinished(Request, Result, ProbedTimecode);
+        });
+    });
 
-    FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
-        [WeakSequence, WeakMovieScene, WeakSection, Notification, StartSeconds, VideoFilePath](float)
+    Request->TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+        [Request](float)
         {
-            ULevelSequence* PinnedSequence = WeakSequence.Get();
-            UMovieScene* PinnedMovieScene = WeakMovieScene.Get();
-            UMovieSceneSection* PinnedSection = WeakSection.Get();
-            if (!PinnedSequence || !PinnedMovieScene || !PinnedSection)
+            if (Request->bDone)
             {
-                if (Notification.IsValid())
-                {
-                    Notification->SetText(FText::FromString(TEXT("Video timecode check failed.")));
-                    Notification->SetCompletionState(SNotificationItem::CS_Fail);
-                    Notification->ExpireAndFadeout();
-                }
                 return false;
             }
 
-            const FTimecode SourceTimecode = PinnedSection->TimecodeSource.Timecode;
-            if (SourceTimecode != FTimecode())
+            UMovieSceneSection* PinnedSection = Request->Section.Get();
+            if (!Request->Sequence.IsValid() || !PinnedSection)
             {
-                UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Video source timecode found: %s"), *SourceTimecode.ToString());
-                FSequenceOpenResult SnapResult;
-                USequencerAbstractionBPLibrary::SnapSectionToSourceTimecode(PinnedSequence, PinnedSection, false, SnapResult);
-                if (!SnapResult.bSuccess)
-                {
-                    UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Failed to snap video section using SequencerAbstraction: %s"), *SnapResult.Error);
-                }
-
-                if (Notification.IsValid())
-                {
-                    Notification->SetText(FText::FromString(TEXT("Video timecode loaded.")));
-                    Notification->SetCompletionState(SNotificationItem::CS_Success);
-                    Notification->ExpireAndFadeout();
-                }
+                FinishTimecodeSnap(*Request, TEXT("Video timecode check failed."), false);
                 return false;
             }
 
-            if (FPlatformTime::Seconds() - StartSeconds >= TimeoutSeconds)
+            if (PinnedSection->TimecodeSource.Timecode != FTimecode())
             {
-                UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Video source timecode was not available after %.1f seconds. Trying ffprobe fallback."), TimeoutSeconds);
-
-                FTimecode FallbackTimecode;
-                const EFfprobeTimecodeResult FallbackResult = TryReadVideoTimecodeWithFfprobe(VideoFilePath, FallbackTimecode);
-                if (FallbackResult == EFfprobeTimecodeResult::Success)
-                {
-                    PinnedSection->TimecodeSource = FMovieSceneTimecodeSource(FallbackTimecode);
-                    UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] ffprobe fallback found video source timecode: %s"), *FallbackTimecode.ToString());
-
-                    FSequenceOpenResult SnapResult;
-                    USequencerAbstractionBPLibrary::SnapSectionToSourceTimecode(PinnedSequence, PinnedSection, false, SnapResult);
-                    if (!SnapResult.bSuccess)
-                    {
-                        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Failed to snap video section using SequencerAbstraction: %s"), *SnapResult.Error);
-                    }
+                SnapSectionToFoundTimecode(*Request, nullptr, TEXT("Video timecode loaded."));
+                return false;
+            }
 
-                    if (Notification.IsValid())
-                    {
-                        Notification->SetText(FText::FromString(TEXT("Video timecode loaded with ffprobe fallback.")));
-                        Notification->SetCompletionState(SNotificationItem::CS_Success);
-                        Notification->ExpireAndFadeout();
-                    }
-                }
-                else if (FallbackResult == EFfprobeTimecodeResult::MissingExecutable)
-                {
-                    if (Notification.IsValid())
-                    {
-                        Notification->SetText(FText::FromString(TEXT("ffprobe not found on PATH; video timecode fallback skipped.")));
-                        Notification->SetCompletionState(SNotificationItem::CS_Fail);
-                        Notification->ExpireAndFadeout();
-                    }
-                }
-                else if (Notification.IsValid())
-                {
-                    Notification->SetText(FText::FromString(TEXT("No video timecode found within 2 seconds.")));
-                    Notification->SetCompletionState(SNotificationItem::CS_Fail);
-                    Notification->ExpireAndFadeout();
-                }
+            // Past the timeout only a still-running probe can answer; it finishes the request itself
+            if (FPlatformTime::Seconds() - Request->StartSeconds >= TimecodeWaitSeconds && Request->bProbeFinished)
+            {
+                FailTimecodeSnap(*Request);
                 return false;
             }
 
@@ -495,6 +826,8 @@ void FEditingSessionSequencerHelper::LoadNextAnimation(
     TSoftObjectPtr<UObject> Rig,
     UAnimSequence* Animation)
 {
+    TOUCAN_LOAD_PHASE(LoadNextAnimation);
+
     if (!Animation)
     {
         UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Invalid animation asset."));
@@ -507,35 +840,166 @@ void FEditingSessionSequencerHelper::LoadNextAnimation(
         return;
     }
 
-    ULevelSequence* LevelSequence = CreateOrLoadLevelSequence();
+    // The clip always goes into the standby slot; the slot being edited now is recycled for the one after
+    const int32 SlotIndex = GetStandbySlotIndex();
+    FSequenceSlot& Slot = SequenceSlots[SlotIndex];
+    ULevelSequence* LevelSequence = CreateOrLoadPoolSequence(SlotIndex);
     if (!LevelSequence)
     {
         UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Failed to create or load Level Sequence."));
         return;
     }
 
+    const bool bPrepared = Slot.IsPreparedFor(Animation, SkeletalMesh.Get(), Rig.Get());
+    const bool bPreparedRigTrack = bPrepared && Slot.bPreparedRigTrack;
+    Slot.PreparedAnimation = nullptr;
+    SequenceSlots[1 - SlotIndex].ResetPrepared();
+    SetActiveSequence(LevelSequence);
+
     if (UAssetEditorSubsystem* EditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
     {
+        TOUCAN_LOAD_PHASE(OpenEditor);
         EditorSubsystem->OpenEditorForAsset(LevelSequence);
         setLooping(LevelSequence);
     }
 
-    RemoveRigFromSequence(LevelSequence);
+    if (bPrepared)
+    {
+        UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Switched to prepared sequence %s for '%s'."), *LevelSequence->GetName(), *Animation->GetName());
+        if (!bPreparedRigTrack)
+        {
+            // Rig tracks are created against the open sequence, so a first-time rig is added now
+            TOUCAN_LOAD_PHASE(AddRig);
+            AddRigToSequence(LevelSequence, Rig);
+            RememberNewRigTrack(Slot, SkeletalMesh.Get());
+        }
+    }
+    else
+    {
+        bool bRigTrackReady = false;
+        if (!BuildClipIntoSequence(LevelSequence, SkeletalMesh, Rig, Animation, true, bRigTrackReady))
+        {
+            return;
+        }
+    }
+
+    if (IAssetEditorInstance* Inst = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()
+        ->FindEditorForAsset(LevelSequence, false))
+    {
+        if (ILevelSequenceEditorToolkit* Toolkit = static_cast<ILevelSequenceEditorToolkit*>(Inst))
+        {
+            if (TSharedPtr<ISequencer> Seq = Toolkit->GetSequencer())
+            {
+                TOUCAN_LOAD_PHASE(ForceEvaluate);
+                Seq->ForceEvaluate(); // ensures ControlRig runtime object is spawned
+            }
+        }
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Loaded animation '%s' into Level Sequence."), *Animation->GetName());
+}
+
+void FEditingSessionSequencerHelper::PrepareNextAnimation(
+    TSoftObjectPtr<USkeletalMesh> SkeletalMesh,
+    TSoftObjectPtr<UObject> Rig,
+    UAnimSequence* Animation,
+    const FString& VideoFilePath)
+{
+    // Runs from its own tick, never inside a clip record; it shows up in Insights and stat output only
+    TRACE_CPUPROFILER_EVENT_SCOPE(ToucanSequencer_PrepareNext);
+    SCOPE_CYCLE_COUNTER(STAT_ToucanSequencer_PrepareNext);
+
+    // Both slots possess the same mesh actor, so a different mesh would change the clip being edited
+    USkeletalMeshComponent* ActiveComponent = GetActiveSkeletalMeshComponent();
+    if (!Animation || !SkeletalMesh.IsValid() || !ActiveComponent || ActiveComponent->GetSkeletalMeshAsset() != SkeletalMesh.Get())
+    {
+        return;
+    }
+
+    const int32 SlotIndex = GetStandbySlotIndex();
+    FSequenceSlot& Slot = SequenceSlots[SlotIndex];
+    if (Slot.IsPreparedFor(Animation, SkeletalMesh.Get(), Rig.Get()) && Slot.PreparedVideoPath == VideoFilePath)
+    {
+        return;
+    }
+
+    ULevelSequence* LevelSequence = CreateOrLoadPoolSequence(SlotIndex);
+    if (!LevelSequence || LevelSequence == GetActiveSequence())
+    {
+        return;
+    }
+
+    // Never rebuild a sequence behind the user's back while it is open
+    UAssetEditorSubsystem* EditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
+    if (EditorSubsystem && EditorSubsystem->FindEditorForAsset(LevelSequence, false))
+    {
+        return;
+    }
+
+    Slot.ResetPrepared();
+    bool bRigTrackReady = false;
+    if (!BuildClipIntoSequence(LevelSequence, SkeletalMesh, Rig, Animation, false, bRigTrackReady))
+    {
+        return;
+    }
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!VideoFilePath.IsEmpty() && FPaths::FileExists(VideoFilePath))
+    {
+        const FString PlaybackVideoFilePath = PeekVideoPathForEditorPlayback(VideoFilePath);
+        UMediaSource* MediaSource = CreatePlaybackMediaSource(LevelSequence, PlaybackVideoFilePath, VideoFilePath);
+        if (UMovieSceneSection* MediaSection = AddMediaPlateVideoSection(LevelSequence, FindOrSpawnMediaPlate(World), MediaSource))
+        {
+            Slot.PreparedVideoPath = VideoFilePath;
+            Slot.PreparedPlaybackPath = PlaybackVideoFilePath;
+            Slot.PreparedMediaSection = MediaSection;
+        }
+    }
+
+    Slot.PreparedAnimation = Animation;
+    Slot.PreparedMesh = SkeletalMesh.Get();
+    Slot.PreparedRig = Rig.Get();
+    Slot.bPreparedRigTrack = bRigTrackReady;
+    UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Prepared '%s' in standby sequence %s."), *Animation->GetName(), *LevelSequence->GetName());
+}
+
+bool FEditingSessionSequencerHelper::BuildClipIntoSequence(
+    ULevelSequence* LevelSequence,
+    TSoftObjectPtr<USkeletalMesh> SkeletalMesh,
+    TSoftObjectPtr<UObject> Rig,
+    UAnimSequence* Animation,
+    bool bCanCreateRigTrack,
+    bool& bOutRigTrackReady)
+{
+    bOutRigTrackReady = false;
+    FSequenceSlot* Slot = FindSequenceSlot(LevelSequence);
+
+    // Same rig on the same mesh: keep the rig track and only wipe its keys, instead of re-instantiating the rig
+    UMovieSceneControlRigParameterTrack* ReusableRigTrack = FindReusableRigTrack(LevelSequence, SkeletalMesh.Get(), Rig.Get());
+    if (!ReusableRigTrack)
+    {
+        TOUCAN_LOAD_PHASE(RemoveRig);
+        RemoveRigFromSequence(LevelSequence);
+    }
 
     // Get current editor world
     UWorld* World = GEditor->GetEditorWorldContext().World();
     if (!World)
     {
         UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] No active world context."));
-        return;
+        return false;
     }
 
     // Spawn or reuse skeletal mesh actor
-    ASkeletalMeshActor* MeshActor = SpawnOrFindSkeletalMeshActor(World, SkeletalMesh);
+    ASkeletalMeshActor* MeshActor = nullptr;
+    {
+        TOUCAN_LOAD_PHASE(SpawnMeshActor);
+        MeshActor = SpawnOrFindSkeletalMeshActor(World, SkeletalMesh);
+    }
     if (!MeshActor)
     {
         UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Could not spawn skeletal mesh actor."));
-        return;
+        return false;
     }
 
     if (MeshActor && MeshActor->GetSkeletalMeshComponent())
@@ -549,60 +1013,90 @@ void FEditingSessionSequencerHelper::LoadNextAnimation(
         MovieScene->SetTickResolutionDirectly(Animation->GetSamplingFrameRate());
 
         // Try to find an existing binding for this actor
-        FGuid BindingID = FEditingSessionSequencerHelper::FindBindingForObject(LevelSequence, MeshActor);
-        if (BindingID.IsValid())
-        {
-            UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Reusing existing possessable binding for %s"), *MeshActor->GetName());
-        }
-        else
+        FGuid BindingID;
         {
-            // Fallback: check by label (rare cases)
-            for (const FMovieSceneBinding& Binding : static_cast<const UMovieScene*>(MovieScene)->GetBindings())
+            TOUCAN_LOAD_PHASE(FindBinding);
+            BindingID = FEditingSessionSequencerHelper::FindBindingForObject(LevelSequence, MeshActor);
+            if (BindingID.IsValid())
+            {
+                UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Reusing existing possessable binding for %s"), *MeshActor->GetName());
+            }
+            else
             {
-                const FMovieScenePossessable* Possessable = MovieScene->FindPossessable(Binding.GetObjectGuid());
-                if (Possessable && Possessable->GetName() == MeshActor->GetActorLabel())
+                // Fallback: check by label (rare cases)
+                for (const FMovieSceneBinding& Binding : static_cast<const UMovieScene*>(MovieScene)->GetBindings())
+                {
+                    const FMovieScenePossessable* Possessable = MovieScene->FindPossessable(Binding.GetObjectGuid());
+                    if (Possessable && Possessable->GetName() == MeshActor->GetActorLabel())
+                    {
+                        BindingID = Binding.GetObjectGuid();
+                        UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Found existing possessable by name for %s"), *MeshActor->GetName());
+                        break;
+                    }
+                }
+
+                // Still nothing? Create it once.
+                if (!BindingID.IsValid())
                 {
-                    BindingID = Binding.GetObjectGuid();
-                    UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Found existing possessable by name for %s"), *MeshActor->GetName());
-                    break;
+                    BindingID = MovieScene->AddPossessable(MeshActor->GetActorLabel(), MeshActor->GetClass());
+                    LevelSequence->BindPossessableObject(BindingID, *MeshActor, World);
+                    UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Created new possessable for %s"), *MeshActor->GetName());
                 }
             }
+        }
 
-            // Still nothing? Create it once.
-            if (!BindingID.IsValid())
-            {
-                BindingID = MovieScene->AddPossessable(MeshActor->GetActorLabel(), MeshActor->GetClass());
-                LevelSequence->BindPossessableObject(BindingID, *MeshActor, World);
-                UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Created new possessable for %s"), *MeshActor->GetName());
-            }
+        // The kept rig track must still sit on the mesh actor's binding
+        FGuid RigTrackBinding;
+        if (ReusableRigTrack && (!MovieScene->FindTrackBinding(*ReusableRigTrack, RigTrackBinding) || RigTrackBinding != BindingID))
+        {
+            TOUCAN_LOAD_PHASE(RemoveRig);
+            RemoveRigFromSequence(LevelSequence);
+            ReusableRigTrack = nullptr;
         }
 
         // Set the anim track and length
+        TOUCAN_LOAD_PHASE(AddAnimationTrack);
         AddAnimationTrack(LevelSequence, Animation, BindingID);
     }
 
     // Add rig if selected
-    AddRigToSequence(LevelSequence, Rig);
-
-    if (IAssetEditorInstance* Inst = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()
-        ->FindEditorForAsset(LevelSequence, false))
     {
-        if (ILevelSequenceEditorToolkit* Toolkit = static_cast<ILevelSequenceEditorToolkit*>(Inst))
+        TOUCAN_LOAD_PHASE(AddRig);
+        if (ReusableRigTrack)
         {
-            if (TSharedPtr<ISequencer> Seq = Toolkit->GetSequencer())
+            ResetRigTrackKeys(LevelSequence, ReusableRigTrack);
+            bOutRigTrackReady = true;
+        }
+        else if (bCanCreateRigTrack)
+        {
+            AddRigToSequence(LevelSequence, Rig);
+            bOutRigTrackReady = true;
+            if (Slot)
             {
-                Seq->ForceEvaluate(); // ensures ControlRig runtime object is spawned
+                RememberNewRigTrack(*Slot, SkeletalMesh.Get());
             }
         }
     }
 
-    UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Loaded animation '%s' into Level Sequence."), *Animation->GetName());
+    return true;
 }
 
 ULevelSequence* FEditingSessionSequencerHelper::CreateOrLoadLevelSequence()
 {
+    return CreateOrLoadPoolSequence(GetStandbySlotIndex());
+}
+
+ULevelSequence* FEditingSessionSequencerHelper::CreateOrLoadPoolSequence(int32 SlotIndex)
+{
+    check(SlotIndex >= 0 && SlotIndex < NumSequenceSlots);
+    FSequenceSlot& Slot = SequenceSlots[SlotIndex];
+    if (ULevelSequence* Cached = Slot.Sequence.Get())
+    {
+        return Cached;
+    }
+
     const FString AssetPath = TEXT("/Game/ToucanTemp");
-    const FString AssetName  = TEXT("EditingSession_Sequence");
+    const FString AssetName  = SequenceSlotAssetNames[SlotIndex];
     FString PackagePath = AssetPath / AssetName;
     FString PackageName = FString::Printf(TEXT("%s/%s"), *AssetPath, *AssetName);
 
@@ -613,7 +1107,7 @@ ULevelSequence* FEditingSessionSequencerHelper::CreateOrLoadLevelSequence()
     ULevelSequence* Existing = LoadObject<ULevelSequence>(nullptr, *PackageName);
     if (Existing)
     {
-        SetActiveSequence(Existing);
+        Slot.Sequence = Existing;
         UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Loaded existing sequence: %s"), *PackageName);
         return Existing;
     }
@@ -644,7 +1138,7 @@ ULevelSequence* FEditingSessionSequencerHelper::CreateOrLoadLevelSequence()
     // Mark as dirty so it will be saved
     Package->MarkPackageDirty();
     NewSequence->MarkPackageDirty();
-    SetActiveSequence(NewSequence);
+    Slot.Sequence = NewSequence;
 
     UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Created new Level Sequence: %s"), *PackageName);
     return NewSequence;
@@ -699,8 +1193,19 @@ ASkeletalMeshActor* FEditingSessionSequencerHelper::SpawnOrFindSkeletalMeshActor
 
     USkeletalMesh* TargetMesh = SkeletalMesh.Get();
     ASkeletalMeshActor* MeshActor = nullptr;
-    
-    for (TActorIterator<ASkeletalMeshActor> It(World); It; ++It)
+
+    // Usually the actor from the last clip; the level is only searched when the mesh changes or the actor went away
+    WatchSessionActors();
+    ASkeletalMeshActor* CachedActor = GetUsableCachedActor(CachedMeshActor, World);
+    if (CachedActor && CachedActor->GetSkeletalMeshComponent()
+        && CachedActor->GetSkeletalMeshComponent()->GetSkeletalMeshAsset() == TargetMesh)
+    {
+        MeshActor = CachedActor;
+    }
+
+    // One pass: an actor already showing the mesh wins, the session actor is the fallback
+    ASkeletalMeshActor* SessionActor = nullptr;
+    for (TActorIterator<ASkeletalMeshActor> It(World); It && !MeshActor; ++It)
     {
         ASkeletalMeshActor* ExistingActor = *It;
         if (!ExistingActor || !ExistingActor->GetSkeletalMeshComponent())
@@ -711,22 +1216,18 @@ ASkeletalMeshActor* FEditingSessionSequencerHelper::SpawnOrFindSkeletalMeshActor
         {
             MeshActor = ExistingActor;
             UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Reusing SkeletalMeshActor with same mesh: %s"), *ExistingActor->GetName());
-            break;
+        }
+        else if (!SessionActor && ExistingActor->GetName() == TEXT("EditingSession_SkeletalMeshActor"))
+        {
+            SessionActor = ExistingActor;
         }
     }
 
     // Fallback
-    if (!MeshActor)
+    if (!MeshActor && SessionActor)
     {
-        for (TActorIterator<ASkeletalMeshActor> It(World); It; ++It)
-        {
-            if (It->GetName() == TEXT("EditingSession_SkeletalMeshActor"))
-            {
-                MeshActor = *It;
-                UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Reusing EditingSession_SkeletalMeshActor."));
-                break;
-            }
-        }
+        MeshActor = SessionActor;
+        UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Reusing EditingSession_SkeletalMeshActor."));
     }
 
     if (!MeshActor)
@@ -734,6 +1235,7 @@ ASkeletalMeshActor* FEditingSessionSequencerHelper::SpawnOrFindSkeletalMeshActor
         MeshActor = World->SpawnActor<ASkeletalMeshActor>(ASkeletalMeshActor::StaticClass());
         MeshActor->SetActorLabel(TEXT("EditingSession_SkeletalMeshActor"));
     }
+    CachedMeshActor = MeshActor;
 
     if (MeshActor && TargetMesh)
     {
@@ -832,6 +1334,25 @@ UMovieSceneSection* FEditingSessionSequencerHelper::AddAnimationTrack(ULevelSequ
     return Section;
 }
 
+// Determine the ControlRig class from either a ControlRig asset or a ControlRig Blueprint.
+UClass* GetControlRigClass(UObject* RigObject)
+{
+    if (!RigObject)
+        return nullptr;
+
+    if (RigObject->IsA(UControlRig::StaticClass()))
+    {
+        return RigObject->GetClass();
+    }
+
+    FProperty* GenClassProp = RigObject->GetClass()->FindPropertyByName(TEXT("GeneratedClass"));
+    if (FObjectProperty* ObjProp = CastField<FObjectProperty>(GenClassProp))
+    {
+        return Cast<UClass>(ObjProp->GetObjectPropertyValue_InContainer(RigObject));
+    }
+    return nullptr;
+}
+
 void FEditingSessionSequencerHelper::AddRigToSequence(
     ULevelSequence* LevelSequence, TSoftObjectPtr<UObject> Rig)
 {
@@ -842,24 +1363,8 @@ void FEditingSessionSequencerHelper::AddRigToSequence(
     if (!RigObject)
         return;
 
-    // Determine the ControlRig class from either a ControlRig asset or a ControlRig Blueprint.
-    UClass* RigClass = nullptr;
-    UControlRig* FoundRig = nullptr;
-
-    if (RigObject->IsA(UControlRig::StaticClass()))
-    {
-        RigClass = RigObject->GetClass();
-        FoundRig = Cast<UControlRig>(RigObject);
-    }
-    else
-    {
-        FProperty* GenClassProp = RigObject->GetClass()->FindPropertyByName(TEXT("GeneratedClass"));
-        if (FObjectProperty* ObjProp = CastField<FObjectProperty>(GenClassProp))
-        {
-            UObject* GenClassObj = ObjProp->GetObjectPropertyValue_InContainer(RigObject);
-            RigClass = Cast<UClass>(GenClassObj);
-        }
-    }
+    UClass* RigClass = GetControlRigClass(RigObject);
+    UControlRig* FoundRig = Cast<UControlRig>(RigObject);
     if (!RigClass)
     {
         UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Invalid or unsupported rig asset."));
@@ -911,6 +1416,95 @@ void FEditingSessionSequencerHelper::AddRigToSequence(
     }
 }
 
+UMovieSceneControlRigParameterTrack* FEditingSessionSequencerHelper::FindReusableRigTrack(
+    ULevelSequence* LevelSequence, USkeletalMesh* Mesh, UObject* RigObject)
+{
+    const FSequenceSlot* Slot = FindSequenceSlot(LevelSequence);
+    if (!Slot || !Mesh || Slot->RigTrackMesh.Get() != Mesh)
+        return nullptr;
+
+    UClass* RigClass = GetControlRigClass(RigObject);
+    UMovieScene* MovieScene = LevelSequence->GetMovieScene();
+    if (!RigClass || !MovieScene)
+        return nullptr;
+
+    // Only the single track AddRigToSequence builds is reused; anything else goes through a full rebuild
+    UMovieSceneControlRigParameterTrack* RigTrack = FindSingleRigTrack(MovieScene);
+    if (!RigTrack || !RigTrack->GetControlRig() || RigTrack->GetControlRig()->GetClass() != RigClass)
+        return nullptr;
+
+    // Its defaults can only be put back if the channels still line up with what was captured at creation
+    const TArray<UMovieSceneSection*>& Sections = RigTrack->GetAllSections();
+    if (Sections.Num() != Slot->RigTrackDefaults.Num())
+        return nullptr;
+    for (int32 Index = 0; Index < Sections.Num(); ++Index)
+    {
+        const FRigSectionDefaults& Defaults = Slot->RigTrackDefaults[Index];
+        UMovieSceneSection* Section = Sections[Index];
+        if (!Section
+            || !ChannelCountMatches<FMovieSceneFloatChannel>(*Section, Defaults.Floats)
+            || !ChannelCountMatches<FMovieSceneDoubleChannel>(*Section, Defaults.Doubles)
+            || !ChannelCountMatches<FMovieSceneBoolChannel>(*Section, Defaults.Bools)
+            || !ChannelCountMatches<FMovieSceneIntegerChannel>(*Section, Defaults.Integers)
+            || !ChannelCountMatches<FMovieSceneByteChannel>(*Section, Defaults.Bytes))
+            return nullptr;
+    }
+
+    return RigTrack;
+}
+
+void FEditingSessionSequencerHelper::ResetRigTrackKeys(ULevelSequence* LevelSequence, UMovieSceneControlRigParameterTrack* RigTrack)
+{
+    UMovieScene* MovieScene = LevelSequence ? LevelSequence->GetMovieScene() : nullptr;
+    if (!MovieScene || !RigTrack)
+        return;
+
+    // FindReusableRigTrack has checked the sections against these
+    const FSequenceSlot* Slot = FindSequenceSlot(LevelSequence);
+    if (!Slot)
+        return;
+
+    const TRange<FFrameNumber> PlaybackRange = MovieScene->GetPlaybackRange();
+    RigTrack->Modify();
+
+    TArray<FKeyHandle> KeyHandles;
+    const TArray<UMovieSceneSection*>& Sections = RigTrack->GetAllSections();
+    for (int32 SectionIndex = 0; SectionIndex < Sections.Num(); ++SectionIndex)
+    {
+        UMovieSceneSection* Section = Sections[SectionIndex];
+        if (!Section)
+            continue;
+        Section->Modify();
+
+        // Unkeyed tweaks live in the defaults, and on a layered track they would carry into the next clip
+        const FRigSectionDefaults& Defaults = Slot->RigTrackDefaults[SectionIndex];
+        RestoreChannelDefaults<FMovieSceneFloatChannel>(*Section, Defaults.Floats);
+        RestoreChannelDefaults<FMovieSceneDoubleChannel>(*Section, Defaults.Doubles);
+        RestoreChannelDefaults<FMovieSceneBoolChannel>(*Section, Defaults.Bools);
+        RestoreChannelDefaults<FMovieSceneIntegerChannel>(*Section, Defaults.Integers);
+        RestoreChannelDefaults<FMovieSceneByteChannel>(*Section, Defaults.Bytes);
+
+        // Drop the previous clip's keys
+        for (const FMovieSceneChannelEntry& Entry : Section->GetChannelProxy().GetAllEntries())
+        {
+            for (FMovieSceneChannel* Channel : Entry.GetChannels())
+            {
+                KeyHandles.Reset();
+                Channel->GetKeys(TRange<FFrameNumber>::All(), nullptr, &KeyHandles);
+                Channel->DeleteKeys(KeyHandles);
+            }
+        }
+
+        // Infinite sections stay infinite; bounded ones follow the new clip
+        if (Section->HasStartFrame() || Section->HasEndFrame())
+        {
+            Section->SetRange(PlaybackRange);
+        }
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Reused ControlRig track '%s'; cleared its keys and restored its defaults."), *RigTrack->GetName());
+}
+
 FGuid FEditingSessionSequencerHelper::FindBindingForObject(
     const ULevelSequence* LevelSequence,
     UObject* InObject,
@@ -1033,7 +1627,11 @@ bool FEditingSessionSequencerHelper::OpenCheckpointSequence(const FString& Check
         return false;
     }
 
-    ULevelSequence* Sequence = Cast<ULevelSequence>(UEditorAssetLibrary::LoadAsset(CheckpointPath));
+    ULevelSequence* Sequence = nullptr;
+    {
+        TOUCAN_LOAD_PHASE(LoadCheckpoint);
+        Sequence = Cast<ULevelSequence>(UEditorAssetLibrary::LoadAsset(CheckpointPath));
+    }
     if (!Sequence)
     {
         UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Cannot open checkpoint sequence: %s"), *CheckpointPath);
@@ -1044,6 +1642,7 @@ bool FEditingSessionSequencerHelper::OpenCheckpointSequence(const FString& Check
 
     if (UAssetEditorSubsystem* EditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
     {
+        TOUCAN_LOAD_PHASE(OpenEditor);
         EditorSubsystem->OpenEditorForAsset(Sequence);
         setLooping(Sequence);
     }
@@ -1053,34 +1652,59 @@ bool FEditingSessionSequencerHelper::OpenCheckpointSequence(const FString& Check
     UMovieScene* MovieScene = Sequence->GetMovieScene();
     if (World && MovieScene)
     {
+        TOUCAN_LOAD_PHASE(FindBinding);
+
+        // Skeletal mesh possessable names in binding order; the earliest binding with a matching actor wins
+        TMap<FString, int32> BindingOrderByName;
         for (const FMovieSceneBinding& Binding : static_cast<const UMovieScene*>(MovieScene)->GetBindings())
         {
             const FMovieScenePossessable* Possessable = MovieScene->FindPossessable(Binding.GetObjectGuid());
-            if (!Possessable || Possessable->GetPossessedObjectClass() != ASkeletalMeshActor::StaticClass())
+            if (Possessable && Possessable->GetPossessedObjectClass() == ASkeletalMeshActor::StaticClass())
             {
-                continue;
+                BindingOrderByName.FindOrAdd(Possessable->GetName(), BindingOrderByName.Num());
             }
+        }
 
-            for (TActorIterator<ASkeletalMeshActor> It(World); It; ++It)
-            {
-                ASkeletalMeshActor* MeshActor = *It;
-                if (!MeshActor || !MeshActor->GetSkeletalMeshComponent())
-                {
-                    continue;
-                }
+        auto GetBindingOrder = [&BindingOrderByName](const ASkeletalMeshActor* MeshActor) -> int32
+        {
+            const int32* ByLabel = BindingOrderByName.Find(MeshActor->GetActorLabel());
+            const int32* ByName = BindingOrderByName.Find(MeshActor->GetName());
+            return FMath::Min(ByLabel ? *ByLabel : MAX_int32, ByName ? *ByName : MAX_int32);
+        };
+
+        // Checkpoints are made from the session actor, so the cached one normally answers without a scan
+        WatchSessionActors();
+        ASkeletalMeshActor* BestActor = nullptr;
+        int32 BestOrder = MAX_int32;
+        ASkeletalMeshActor* CachedActor = GetUsableCachedActor(CachedMeshActor, World);
+        if (CachedActor && CachedActor->GetSkeletalMeshComponent() && GetBindingOrder(CachedActor) == 0)
+        {
+            BestActor = CachedActor;
+            BestOrder = 0;
+        }
 
-                if (MeshActor->GetActorLabel() == Possessable->GetName() || MeshActor->GetName() == Possessable->GetName())
-                {
-                    SetActiveSkeletalMeshComponent(MeshActor->GetSkeletalMeshComponent());
-                    break;
-                }
+        // Otherwise one pass over the level, stopping as soon as the first binding is matched
+        for (TActorIterator<ASkeletalMeshActor> It(World); It && BestOrder > 0 && BindingOrderByName.Num() > 0; ++It)
+        {
+            ASkeletalMeshActor* MeshActor = *It;
+            if (!MeshActor || !MeshActor->GetSkeletalMeshComponent())
+            {
+                continue;
             }
 
-            if (GetActiveSkeletalMeshComponent())
+            const int32 Order = GetBindingOrder(MeshActor);
+            if (Order < BestOrder)
             {
-                break;
+                BestOrder = Order;
+                BestActor = MeshActor;
             }
         }
+
+        if (BestActor)
+        {
+            CachedMeshActor = BestActor;
+            SetActiveSkeletalMeshComponent(BestActor->GetSkeletalMeshComponent());
+        }
     }
 
     UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Opened checkpoint sequence: %s"), *CheckpointPath);
@@ -1306,50 +1930,52 @@ void FEditingSessionSequencerHelper::LoadVideoForCurrentSequence(const FString&
         return;
     }
 
-    const FString PlaybackVideoFilePath = ResolveVideoPathForEditorPlayback(VideoFilePath);
+    FString PendingProxyPath;
+    const FString PlaybackVideoFilePath = ResolveVideoPathForEditorPlayback(VideoFilePath, PendingProxyPath);
+    PendingProxySwap = FPendingProxySwap();
 
-    UFileMediaSource* MediaSource = NewObject<UFileMediaSource>(Sequence, NAME_None, RF_Transactional);
-    MediaSource->SetFilePath(PlaybackVideoFilePath);
-    AMediaPlate* MediaPlate = AssignMediaSourceToMediaPlate(MediaSource);
-
-    FSequenceOpenResult BindingResult;
-    const FGuid MediaPlateBindingID = USequencerAbstractionBPLibrary::FindOrCreatePossessableBinding(
-        Sequence,
-        MediaPlate,
-        BindingResult);
-    if (!BindingResult.bSuccess || !MediaPlateBindingID.IsValid())
+    // A sequence prepared with the next clip already holds the section; it only needs the plate and the current playback file
+    UMovieSceneSection* MediaSection = nullptr;
+    FSequenceSlot* Slot = FindSequenceSlot(Sequence);
+    UMovieSceneMediaSection* PreparedSection = (Slot && Slot->PreparedVideoPath == VideoFilePath)
+        ? Cast<UMovieSceneMediaSection>(Slot->PreparedMediaSection.Get())
+        : nullptr;
+    if (PreparedSection && PreparedSection->GetMediaSource())
     {
-        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Cannot load video: failed to bind MediaPlate to sequence: %s"), *BindingResult.Error);
-        return;
+        if (Slot->PreparedPlaybackPath != PlaybackVideoFilePath)
+        {
+            PreparedSection->Modify();
+            PreparedSection->SetMediaSource(CreatePlaybackMediaSource(Sequence, PlaybackVideoFilePath, VideoFilePath));
+        }
+        AssignMediaSourceToMediaPlate(PreparedSection->GetMediaSource());
+        MediaSection = PreparedSection;
+        UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Using prepared video section: %s"), *VideoFilePath);
     }
-
-    FSequenceOpenResult RemoveMediaTracksResult;
-    const int32 RemovedMediaTracks = USequencerAbstractionBPLibrary::RemoveMediaTracksFromBinding(
-        Sequence,
-        MediaPlateBindingID,
-        RemoveMediaTracksResult);
-    if (!RemoveMediaTracksResult.bSuccess)
+    else
     {
-        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Failed to clear old MediaPlate media tracks: %s"), *RemoveMediaTracksResult.Error);
+        UMediaSource* MediaSource = CreatePlaybackMediaSource(Sequence, PlaybackVideoFilePath, VideoFilePath);
+        AMediaPlate* MediaPlate = AssignMediaSourceToMediaPlate(MediaSource);
+        MediaSection = AddMediaPlateVideoSection(Sequence, MediaPlate, MediaSource);
+        if (!MediaSection)
+        {
+            return;
+        }
     }
-    else if (RemovedMediaTracks > 0)
+    if (Slot)
     {
-        UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Removed %d old MediaPlate media track(s)."), RemovedMediaTracks);
+        Slot->ResetPreparedVideo();
     }
 
-    const FFrameNumber InitialFrame = MovieScene->GetPlaybackRange().GetLowerBoundValue();
-    FSequenceOpenResult MediaSectionResult;
-    UMovieSceneSection* MediaSection = USequencerAbstractionBPLibrary::AddMediaSourceProxySectionToBinding(
-        Sequence,
-        MediaPlateBindingID,
-        MediaSource,
-        InitialFrame.Value,
-        0,
-        MediaSectionResult);
-    if (!MediaSectionResult.bSuccess || !MediaSection)
+    // Play what we have now and move to the proxy once the queue finishes it
+    if (!PendingProxyPath.IsEmpty())
     {
-        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Cannot load video: failed to create MediaPlate media section: %s"), *MediaSectionResult.Error);
-        return;
+        if (!ProxyFinishedHandle.IsValid())
+        {
+            ProxyFinishedHandle = FVideoProxyQueue::Get().OnProxyFinished().AddStatic(&OnVideoProxyFinished);
+        }
+        PendingProxySwap.Sequence = Sequence;
+        PendingProxySwap.Section = MediaSection;
+        PendingProxySwap.ProxyPath = PendingProxyPath;
     }
 
     UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Added video to sequence, waiting for source timecode: %s (playback: %s)"), *VideoFilePath, *PlaybackVideoFilePath);
@@ -1399,7 +2025,20 @@ void FEditingSessionSequencerHelper::RemoveRigFromSequence(ULevelSequence* Level
         MovieScene->RemoveTrack(*Track);
     }
 
-    ActiveRig = nullptr;
+    if (LevelSequence == GetActiveSequence())
+    {
+        ActiveRig = nullptr;
+    }
+    if (FSequenceSlot* Slot = FindSequenceSlot(LevelSequence))
+    {
+        Slot->RigTrackMesh = nullptr;
+        Slot->RigTrackDefaults.Reset();
+    }
+}
+
+void FEditingSessionSequencerHelper::Shutdown()
+{
+    StopWatchingSessionActors();
 }
 
 void FEditingSessionSequencerHelper::BakeAndSave() { /* call OnBakeSaveAnimation on current session */ }
@@ -0,0 +1,122 @@
+#include "LoadTimings.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+    // CSV column order; phases not listed here still show up in Insights and stat output
+    const TCHAR* const PhaseColumns[] =
+    {
+        TEXT("LoadAnimationAsset"),
+        TEXT("LoadCheckpoint"),
+        TEXT("LoadNextAnimation"),
+        TEXT("OpenEditor"),
+        TEXT("RemoveRig"),
+        TEXT("SpawnMeshActor"),
+        TEXT("FindBinding"),
+        TEXT("AddAnimationTrack"),
+        TEXT("AddRig"),
+        TEXT("ForceEvaluate"),
+        TEXT("LoadVideo"),
+    };
+
+    FString GetCsvPath()
+    {
+        return FPaths::ProjectSavedDir() / TEXT("ToucanSessionSequencer/LoadTimings.csv");
+    }
+}
+
+void FLoadTimings::BeginClip(const FString& InClipName)
+{
+    if (ClipDepth++ > 0)
+    {
+        return;
+    }
+
+    ClipName = InClipName;
+    ClipStartSeconds = FPlatformTime::Seconds();
+    PhaseSeconds.Reset();
+}
+
+void FLoadTimings::EndClip()
+{
+    if (ClipDepth == 0 || --ClipDepth > 0)
+    {
+        return;
+    }
+
+    const double TotalSeconds = FPlatformTime::Seconds() - ClipStartSeconds;
+    WriteRow(TotalSeconds);
+
+    FString Summary;
+    for (const TCHAR* Column : PhaseColumns)
+    {
+        if (const double* Seconds = PhaseSeconds.Find(Column))
+        {
+            Summary += FString::Printf(TEXT(" %s=%.0fms"), Column, *Seconds * 1000.0);
+        }
+    }
+    UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Loaded '%s' in %.0fms:%s"), *ClipName, TotalSeconds * 1000.0, *Summary);
+}
+
+void FLoadTimings::AddPhase(const TCHAR* PhaseName, double Seconds)
+{
+    if (ClipDepth > 0)
+    {
+        PhaseSeconds.FindOrAdd(PhaseName) += Seconds;
+    }
+}
+
+void FLoadTimings::AddEarlierPhase(const TCHAR* PhaseName, double Seconds)
+{
+    if (ClipDepth == 0)
+    {
+        return;
+    }
+
+    PhaseSeconds.FindOrAdd(PhaseName) += Seconds;
+    if (ClipDepth == 1)
+    {
+        ClipStartSeconds -= Seconds; // a nested clip's earlier work already sits inside the outer clip's span
+    }
+}
+
+void FLoadTimings::WriteRow(double TotalSeconds)
+{
+    const FString CsvPath = GetCsvPath();
+    FString Header = TEXT("Timestamp,Clip,TotalMs");
+    for (const TCHAR* Column : PhaseColumns)
+    {
+        Header += FString::Printf(TEXT(",%sMs"), Column);
+    }
+
+    // A file written with other columns is set aside rather than appended to out of line
+    if (!bCheckedCsvHeader)
+    {
+        bCheckedCsvHeader = true;
+        TArray<FString> Lines;
+        if (FFileHelper::LoadFileToStringArray(Lines, *CsvPath) && Lines.Num() > 0 && Lines[0] != Header)
+        {
+            const FString OldPath = FPaths::GetPath(CsvPath) / FString::Printf(TEXT("LoadTimings-%s.csv"), *FDateTime::Now().ToString());
+            IFileManager::Get().Move(*OldPath, *CsvPath, true, true);
+        }
+    }
+
+    FString Row;
+    if (!FPaths::FileExists(CsvPath))
+    {
+        IFileManager::Get().MakeDirectory(*FPaths::GetPath(CsvPath), true);
+        Row = Header + TEXT("\n");
+    }
+
+    Row += FString::Printf(TEXT("%s,\"%s\",%.1f"), *FDateTime::Now().ToIso8601(), *ClipName.Replace(TEXT("\""), TEXT("\"\"")), TotalSeconds * 1000.0);
+    for (const TCHAR* Column : PhaseColumns)
+    {
+        const double* Seconds = PhaseSeconds.Find(Column);
+        Row += Seconds ? FString::Printf(TEXT(",%.1f"), *Seconds * 1000.0) : FString(TEXT(","));
+    }
+    Row += TEXT("\n");
+
+    FFileHelper::SaveStringToFile(Row, *CsvPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append);
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("ToucanSequencer"), STATGROUP_ToucanSequencer, STATCAT_Advanced);
+
+/**
+ * Wall-clock timings for loading one clip. Phases that run while a clip is open are summed by name and
+ * written as one row of Saved/ToucanSessionSequencer/LoadTimings.csv when the clip closes. Game thread only.
+ */
+class FLoadTimings
+{
+public:
+    static FLoadTimings& Get()
+    {
+        static FLoadTimings S;
+        return S;
+    }
+
+    void BeginClip(const FString& ClipName); // nested clips fold into the outermost one
+    void EndClip();
+    void AddPhase(const TCHAR* PhaseName, double Seconds); // ignored outside a clip
+    void AddEarlierPhase(const TCHAR* PhaseName, double Seconds); // timed before the clip began, e.g. ahead of a modal prompt; counted in its total
+
+private:
+    FLoadTimings() = default;
+
+    void WriteRow(double TotalSeconds);
+
+    FString ClipName;
+    double ClipStartSeconds = 0.0;
+    int32 ClipDepth = 0;
+    TMap<FString, double> PhaseSeconds;
+    bool bCheckedCsvHeader = false;
+};
+
+class FScopedLoadClip
+{
+public:
+    explicit FScopedLoadClip(const FString& ClipName) { FLoadTimings::Get().BeginClip(ClipName); }
+    FScopedLoadClip(const FString& ClipName, const TCHAR* EarlierPhaseName, double EarlierPhaseSeconds)
+    {
+        FLoadTimings::Get().BeginClip(ClipName);
+        FLoadTimings::Get().AddEarlierPhase(EarlierPhaseName, EarlierPhaseSeconds);
+    }
+    ~FScopedLoadClip() { FLoadTimings::Get().EndClip(); }
+    UE_NONCOPYABLE(FScopedLoadClip);
+};
+
+class FScopedLoadPhase
+{
+public:
+    explicit FScopedLoadPhase(const TCHAR* InPhaseName) : PhaseName(InPhaseName), StartSeconds(FPlatformTime::Seconds()) {}
+    ~FScopedLoadPhase() { FLoadTimings::Get().AddPhase(PhaseName, FPlatformTime::Seconds() - StartSeconds); }
+    UE_NONCOPYABLE(FScopedLoadPhase);
+
+private:
+    const TCHAR* PhaseName;
+    double StartSeconds;
+};
+
+/** Times into a caller's variable rather than the open clip, for phases that run before their clip begins */
+class FScopedPhaseTimer
+{
+public:
+    explicit FScopedPhaseTimer(double& InOutSeconds) : OutSeconds(InOutSeconds), StartSeconds(FPlatformTime::Seconds()) {}
+    ~FScopedPhaseTimer() { OutSeconds += FPlatformTime::Seconds() - StartSeconds; }
+    UE_NONCOPYABLE(FScopedPhaseTimer);
+
+private:
+    double& OutSeconds;
+    double StartSeconds;
+};
+
+/** Insights region, STATGROUP_ToucanSequencer cycle stat and CSV column for one load phase.
+ *  The including file declares STAT_ToucanSequencer_<Name> with DECLARE_CYCLE_STAT. */
+#define TOUCAN_LOAD_PHASE(Name) \
+    TRACE_CPUPROFILER_EVENT_SCOPE(ToucanSequencer_##Name); \
+    SCOPE_CYCLE_COUNTER(STAT_ToucanSequencer_##Name); \
+    FScopedLoadPhase PREPROCESSOR_JOIN(ToucanLoadPhase_, __LINE__)(TEXT(#Name))
+
+/** TOUCAN_LOAD_PHASE for work done before the clip opens; the time lands in OutSeconds for FScopedLoadClip to pick up */
+#define TOUCAN_EARLY_LOAD_PHASE(Name, OutSeconds) \
+    TRACE_CPUPROFILER_EVENT_SCOPE(ToucanSequencer_##Name); \
+    SCOPE_CYCLE_COUNTER(STAT_ToucanSequencer_##Name); \
+    FScopedPhaseTimer PREPROCESSOR_JOIN(ToucanEarlyLoadPhase_, __LINE__)(OutSeconds)
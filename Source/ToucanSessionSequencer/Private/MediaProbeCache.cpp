@@ -0,0 +1,264 @@
+#include "MediaProbeCache.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+    constexpr const TCHAR* CacheHeader = TEXT("TOUCANP\t1");
+    constexpr int32 NumFields = 8; // width, height, rate num, rate den, duration, codec, timecode, key
+
+    FString GetCachePath()
+    {
+        return FPaths::ProjectSavedDir() / TEXT("ToucanSessionSequencer/MediaProbe.tsv");
+    }
+
+    FString MakeLine(const FString& Key, const FMediaProbeInfo& Info)
+    {
+        // Key goes last because it holds a path; the other fields never contain tabs
+        return FString::Printf(TEXT("%d\t%d\t%d\t%d\t%.6f\t%s\t%s\t%s\n"),
+            Info.Resolution.X, Info.Resolution.Y,
+            Info.FrameRate.Numerator, Info.FrameRate.Denominator,
+            Info.DurationSeconds,
+            *Info.CodecName, *Info.Timecode, *Key);
+    }
+
+    // A successful probe always has a frame size; an empty entry records a file ffprobe could not read
+    bool IsFailedEntry(const FMediaProbeInfo& Info)
+    {
+        return Info.Resolution.X <= 0 || Info.Resolution.Y <= 0;
+    }
+
+    bool TryParseFrameRate(const FString& Text, FFrameRate& OutRate)
+    {
+        FString NumText;
+        FString DenText;
+        if (!Text.Split(TEXT("/"), &NumText, &DenText))
+        {
+            return false;
+        }
+
+        const int32 Numerator = FCString::Atoi(*NumText);
+        const int32 Denominator = FCString::Atoi(*DenText);
+        if (Numerator <= 0 || Denominator <= 0)
+        {
+            return false;
+        }
+
+        OutRate = FFrameRate(Numerator, Denominator);
+        return true;
+    }
+
+    FString GetTimecodeTag(const TSharedPtr<FJsonObject>& Object)
+    {
+        const TSharedPtr<FJsonObject>* Tags = nullptr;
+        FString Timecode;
+        if (Object.IsValid() && Object->TryGetObjectField(TEXT("tags"), Tags) && Tags)
+        {
+            (*Tags)->TryGetStringField(TEXT("timecode"), Timecode);
+        }
+        return Timecode;
+    }
+}
+
+FString FMediaProbeCache::MakeSourceKey(const FString& FilePath)
+{
+    const FFileStatData StatData = IFileManager::Get().GetStatData(*FilePath);
+    return FString::Printf(
+        TEXT("%s|%lld|%s"),
+        *FilePath,
+        StatData.FileSize,
+        *StatData.ModificationTime.ToString());
+}
+
+EMediaProbeResult FMediaProbeCache::Probe(const FString& FilePath, FMediaProbeInfo& OutInfo)
+{
+    const FString Key = MakeSourceKey(FilePath);
+    {
+        FScopeLock ScopeLock(&Lock);
+        LoadIfNeeded();
+        if (const FMediaProbeInfo* Cached = Entries.Find(Key))
+        {
+            if (IsFailedEntry(*Cached))
+            {
+                return EMediaProbeResult::Failed;
+            }
+            OutInfo = *Cached;
+            return EMediaProbeResult::Success;
+        }
+    }
+
+    if (bFfprobeMissing)
+    {
+        return EMediaProbeResult::MissingExecutable;
+    }
+
+    // Run outside the lock so other threads can keep hitting the cache
+    const EMediaProbeResult Result = RunFfprobe(FilePath, OutInfo);
+    if (Result == EMediaProbeResult::MissingExecutable)
+    {
+        bFfprobeMissing = true;
+    }
+    else
+    {
+        // Failures are remembered under the same key, so an unreadable file is not probed again until it changes
+        const FMediaProbeInfo Entry = Result == EMediaProbeResult::Success ? OutInfo : FMediaProbeInfo();
+        FScopeLock ScopeLock(&Lock);
+        Entries.Add(Key, Entry);
+        AppendToDisk(Key, Entry);
+    }
+    return Result;
+}
+
+bool FMediaProbeCache::TryGetCached(const FString& FilePath, FMediaProbeInfo& OutInfo)
+{
+    const FString Key = MakeSourceKey(FilePath);
+    FScopeLock ScopeLock(&Lock);
+    LoadIfNeeded();
+    const FMediaProbeInfo* Cached = Entries.Find(Key);
+    if (Cached && !IsFailedEntry(*Cached))
+    {
+        OutInfo = *Cached;
+        return true;
+    }
+    return false;
+}
+
+void FMediaProbeCache::LoadIfNeeded()
+{
+    if (bLoaded)
+    {
+        return;
+    }
+    bLoaded = true;
+
+    TArray<FString> Lines;
+    if (!FFileHelper::LoadFileToStringArray(Lines, *GetCachePath()) || Lines.Num() == 0 || Lines[0] != CacheHeader)
+    {
+        return;
+    }
+
+    for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+    {
+        TArray<FString> Fields;
+        Lines[LineIndex].ParseIntoArray(Fields, TEXT("\t"), false);
+        if (Fields.Num() != NumFields || Fields[7].IsEmpty())
+        {
+            continue;
+        }
+
+        FMediaProbeInfo Info;
+        Info.Resolution = FIntPoint(FCString::Atoi(*Fields[0]), FCString::Atoi(*Fields[1]));
+        Info.FrameRate = FFrameRate(FMath::Max(FCString::Atoi(*Fields[2]), 1), FMath::Max(FCString::Atoi(*Fields[3]), 1));
+        Info.DurationSeconds = FCString::Atod(*Fields[4]);
+        Info.CodecName = Fields[5];
+        Info.Timecode = Fields[6];
+        Entries.Add(Fields[7], MoveTemp(Info));
+    }
+
+    // Edited or re-probed files leave superseded lines behind; rewrite once they dominate
+    if (Lines.Num() - 1 > Entries.Num() * 2 + 16)
+    {
+        FString Contents = FString(CacheHeader) + TEXT("\n");
+        for (const TPair<FString, FMediaProbeInfo>& Pair : Entries)
+        {
+            Contents += MakeLine(Pair.Key, Pair.Value);
+        }
+        FFileHelper::SaveStringToFile(Contents, *GetCachePath(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+    }
+}
+
+void FMediaProbeCache::AppendToDisk(const FString& Key, const FMediaProbeInfo& Info)
+{
+    const FString CachePath = GetCachePath();
+    FString Contents;
+    if (!FPaths::FileExists(CachePath))
+    {
+        IFileManager::Get().MakeDirectory(*FPaths::GetPath(CachePath), true);
+        Contents = FString(CacheHeader) + TEXT("\n");
+    }
+    Contents += MakeLine(Key, Info);
+    FFileHelper::SaveStringToFile(Contents, *CachePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append);
+}
+
+EMediaProbeResult FMediaProbeCache::RunFfprobe(const FString& FilePath, FMediaProbeInfo& OutInfo)
+{
+    FString StdOut;
+    FString StdErr;
+    int32 ReturnCode = 0;
+    const FString Args = FString::Printf(
+        TEXT("-v error -select_streams v:0 -print_format json -show_entries stream=codec_name,width,height,r_frame_rate,avg_frame_rate,duration:stream_tags=timecode:format=duration:format_tags=timecode \"%s\""),
+        *FilePath);
+
+    if (!FPlatformProcess::ExecProcess(TEXT("ffprobe"), *Args, &ReturnCode, &StdOut, &StdErr))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Media probe skipped: ffprobe was not found on PATH."));
+        return EMediaProbeResult::MissingExecutable;
+    }
+
+    if (ReturnCode != 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] ffprobe failed with exit code %d: %s"), ReturnCode, *StdErr);
+        return EMediaProbeResult::Failed;
+    }
+
+    TSharedPtr<FJsonObject> Root;
+    const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(StdOut);
+    const TArray<TSharedPtr<FJsonValue>>* Streams = nullptr;
+    if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() || !Root->TryGetArrayField(TEXT("streams"), Streams) || !Streams || Streams->Num() == 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Could not parse ffprobe output for %s: %s"), *FilePath, *StdOut);
+        return EMediaProbeResult::Failed;
+    }
+
+    const TSharedPtr<FJsonObject> Stream = (*Streams)[0]->AsObject();
+    const TSharedPtr<FJsonObject>* FormatField = nullptr;
+    const TSharedPtr<FJsonObject> Format = Root->TryGetObjectField(TEXT("format"), FormatField) && FormatField ? *FormatField : nullptr;
+    if (!Stream.IsValid())
+    {
+        return EMediaProbeResult::Failed;
+    }
+
+    FMediaProbeInfo Info;
+    if (!Stream->TryGetNumberField(TEXT("width"), Info.Resolution.X) || !Stream->TryGetNumberField(TEXT("height"), Info.Resolution.Y))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] ffprobe reported no frame size for %s"), *FilePath);
+        return EMediaProbeResult::Failed;
+    }
+    Stream->TryGetStringField(TEXT("codec_name"), Info.CodecName);
+
+    FString RateText;
+    if (!(Stream->TryGetStringField(TEXT("avg_frame_rate"), RateText) && TryParseFrameRate(RateText, Info.FrameRate)))
+    {
+        if (Stream->TryGetStringField(TEXT("r_frame_rate"), RateText))
+        {
+            TryParseFrameRate(RateText, Info.FrameRate);
+        }
+    }
+
+    // Durations come back as strings; the container's is there for codecs that omit the stream's
+    FString DurationText;
+    if (Stream->TryGetStringField(TEXT("duration"), DurationText) || (Format.IsValid() && Format->TryGetStringField(TEXT("duration"), DurationText)))
+    {
+        Info.DurationSeconds = FCString::Atod(*DurationText);
+    }
+
+    Info.Timecode = GetTimecodeTag(Stream);
+    if (Info.Timecode.IsEmpty())
+    {
+        Info.Timecode = GetTimecodeTag(Format);
+    }
+
+    if (Info.Resolution.X <= 0 || Info.Resolution.Y <= 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] ffprobe found no video stream in %s"), *FilePath);
+        return EMediaProbeResult::Failed;
+    }
+
+    OutInfo = MoveTemp(Info);
+    return EMediaProbeResult::Success;
+}
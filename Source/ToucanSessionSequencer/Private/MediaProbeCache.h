@@ -0,0 +1,58 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Misc/FrameRate.h"
+#include "Misc/Timecode.h"
+#include <atomic>
+
+/** What one ffprobe pass tells us about a video's first video stream */
+struct FMediaProbeInfo
+{
+    FIntPoint Resolution = FIntPoint::ZeroValue;
+    FFrameRate FrameRate;
+    double DurationSeconds = 0.0; // 0 if unknown
+    FString CodecName;
+    FString Timecode; // as ffprobe reports it, e.g. "01:02:03:04"; empty if the file has none
+
+    TOptional<FTimecode> GetTimecode() const { return Timecode.IsEmpty() ? TOptional<FTimecode>() : FTimecode::ParseTimecode(*Timecode); }
+};
+
+enum class EMediaProbeResult : uint8
+{
+    Success,
+    MissingExecutable,
+    Failed,
+};
+
+/**
+ * ffprobe results cached in memory and in Saved/ToucanSessionSequencer/MediaProbe.tsv.
+ * Entries are keyed by path, size and modification time, so an edited file is probed again;
+ * files ffprobe could not read are cached as failures the same way.
+ * Safe to call from any thread; a miss blocks the caller on one ffprobe process.
+ */
+class FMediaProbeCache
+{
+public:
+    static FMediaProbeCache& Get()
+    {
+        static FMediaProbeCache S;
+        return S;
+    }
+
+    /** "path|size|mtime"; the identity of a source file for every on-disk cache */
+    static FString MakeSourceKey(const FString& FilePath);
+
+    EMediaProbeResult Probe(const FString& FilePath, FMediaProbeInfo& OutInfo);
+    bool TryGetCached(const FString& FilePath, FMediaProbeInfo& OutInfo); // never spawns a process
+
+private:
+    FMediaProbeCache() = default;
+
+    void LoadIfNeeded(); // caller holds Lock
+    void AppendToDisk(const FString& Key, const FMediaProbeInfo& Info); // caller holds Lock
+    static EMediaProbeResult RunFfprobe(const FString& FilePath, FMediaProbeInfo& OutInfo);
+
+    FCriticalSection Lock;
+    TMap<FString, FMediaProbeInfo> Entries;
+    bool bLoaded = false;
+    std::atomic<bool> bFfprobeMissing{ false }; // stop spawning once PATH has proven not to have it
+};
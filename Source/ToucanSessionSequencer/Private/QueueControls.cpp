@@ -52,8 +52,7 @@ void FQueueControls::AddAnimationsFromFolder()
                     TArray<FAssetData> Out;
                     ARM.Get().GetAssets(Filter, Out);
 
-                    for (const FAssetData& A : Out)
-                        FSeqQueue::Get().Add(A);
+                    FSeqQueue::Get().AddBatch(Out);
                 }
                 WinPtr->RequestDestroyWindow();
                 return FReply::Handled();
@@ -86,8 +85,7 @@ void FQueueControls::AddAnimationsByHand()
         C,
         FOnAssetsChosenForOpen::CreateLambda([](const TArray<FAssetData>& Selected)
         {
-            for (const FAssetData& A : Selected)
-                FSeqQueue::Get().Add(A);
+            FSeqQueue::Get().AddBatch(Selected);
         }),
         FOnAssetDialogCancelled::CreateLambda([] {})
     );
@@ -111,18 +109,10 @@ void FQueueControls::RemoveAllAnimations()
 
 void FQueueControls::RemoveMarkedProcessedAnimations()
 {
-    auto& Queue = FSeqQueue::Get();
-    auto All = Queue.GetAll(); // copy to iterate safely
-    int32 RemovedCount = 0;
-
-    for (int32 i = All.Num() - 1; i >= 0; --i)
+    const int32 RemovedCount = FSeqQueue::Get().RemoveAll([](const FQueuedAnim& Item)
     {
-        if (All[i].bProcessed)
-        {
-            Queue.RemoveAt(i);
-            ++RemovedCount;
-        }
-    }
+        return Item.bProcessed;
+    });
 
     UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Removed %d processed animations from queue."), RemovedCount);
 }
@@ -29,7 +29,16 @@
 #include "Exporters/AnimSequenceExporterFBX.h"
 #include "Exporters/FbxExportOption.h"
 #include "Animation/AnimSequence.h"
+#include "AnimPreloader.h"
 #include "EditingSessionDelegates.h"
+#include "CheckpointExistenceCache.h"
+#include "LoadTimings.h"
+#include "VideoFolderIndex.h"
+#include "VideoNameMatcher.h"
+#include "VideoMatchAllJob.h"
+
+DECLARE_CYCLE_STAT(TEXT("Load animation asset"), STAT_ToucanSequencer_LoadAnimationAsset, STATGROUP_ToucanSequencer);
+DECLARE_CYCLE_STAT(TEXT("Load matched video"), STAT_ToucanSequencer_LoadVideo, STATGROUP_ToucanSequencer);
 
 TSharedRef<SWidget> SEditingSessionWindow::AddIconHere(const FString& IconName, const FVector2D& Size)
 {
@@ -157,7 +166,7 @@ namespace
             return false;
 
         OutCheckpointPath = Item.CheckpointPath;
-        return UEditorAssetLibrary::DoesAssetExist(OutCheckpointPath);
+        return FCheckpointExistenceCache::Get().DoesAssetExist(OutCheckpointPath);
     }
 
     bool IsQueuedAnimCheckpointed(const FQueuedAnim& Item)
@@ -177,7 +186,7 @@ namespace
         const FString CheckpointPath = UEditorAssetLibrary::GetMetadataTag(Asset, TEXT("CheckpointPath"));
         if (Checkpointed.Equals(TEXT("True"), ESearchCase::IgnoreCase) &&
             !CheckpointPath.IsEmpty() &&
-            UEditorAssetLibrary::DoesAssetExist(CheckpointPath))
+            FCheckpointExistenceCache::Get().DoesAssetExist(CheckpointPath))
         {
             Queue.SetProcessed(Item.Path, false);
             Queue.SetCheckpoint(Item.Path, CheckpointPath);
@@ -196,77 +205,14 @@ namespace
             Queue.SetProcessed(Item.Path, false);
         }
     }
-
-    FString NormalizeMatchString(const FString& InString)
-    {
-        FString Out;
-        Out.Reserve(InString.Len());
-        for (TCHAR Char : InString)
-        {
-            if (FChar::IsAlnum(Char))
-            {
-                Out.AppendChar(FChar::ToLower(Char));
-            }
-        }
-        return Out;
-    }
-
-    int32 LongestCommonSubsequenceLength(const FString& A, const FString& B)
-    {
-        if (A.IsEmpty() || B.IsEmpty())
-        {
-            return 0;
-        }
-
-        TArray<int32> Previous;
-        TArray<int32> Current;
-        Previous.Init(0, B.Len() + 1);
-        Current.Init(0, B.Len() + 1);
-
-        for (int32 AIndex = 1; AIndex <= A.Len(); ++AIndex)
-        {
-            for (int32 BIndex = 1; BIndex <= B.Len(); ++BIndex)
-            {
-                if (A[AIndex - 1] == B[BIndex - 1])
-                {
-                    Current[BIndex] = Previous[BIndex - 1] + 1;
-                }
-                else
-                {
-                    Current[BIndex] = FMath::Max(Previous[BIndex], Current[BIndex - 1]);
-                }
-            }
-            Swap(Previous, Current);
-            Current.Init(0, B.Len() + 1);
-        }
-
-        return Previous[B.Len()];
-    }
-
-    int32 ScoreVideoNameMatch(const FString& QueueName, const FString& VideoName)
-    {
-        const FString NormalizedQueueName = NormalizeMatchString(QueueName);
-        const FString NormalizedVideoName = NormalizeMatchString(VideoName);
-        if (NormalizedQueueName.IsEmpty() || NormalizedVideoName.IsEmpty())
-        {
-            return 0;
-        }
-
-        if (NormalizedVideoName.Contains(NormalizedQueueName) || NormalizedQueueName.Contains(NormalizedVideoName))
-        {
-            return 1000 + FMath::Min(NormalizedQueueName.Len(), NormalizedVideoName.Len());
-        }
-
-        const int32 LcsLength = LongestCommonSubsequenceLength(NormalizedQueueName, NormalizedVideoName);
-        const int32 Denominator = FMath::Max(NormalizedQueueName.Len(), NormalizedVideoName.Len());
-        return Denominator > 0 ? FMath::RoundToInt(100.0f * static_cast<float>(LcsLength) / static_cast<float>(Denominator)) : 0;
-    }
 }
 
 void SEditingSessionWindow::Construct(const FArguments&)
 {
     RefreshQueue();
-    FSeqQueue::Get().OnQueueChanged().AddSP(this, &SEditingSessionWindow::RefreshQueue);
+    FSeqQueue::Get().OnQueueItemsChanged().AddSP(this, &SEditingSessionWindow::OnQueueItemsChanged);
+    FVideoFolderIndex::Get().OnIndexUpdated().AddSP(this, &SEditingSessionWindow::OnVideoIndexUpdated);
+    FAnimPreloader::Get().OnAnimationPreloaded().AddSP(this, &SEditingSessionWindow::OnAnimationPreloaded);
 
     ChildSlot
         [
@@ -557,6 +503,15 @@ TSharedRef<SWidget> SEditingSessionWindow::BuildSessionControlsRow()
                                         ]
                                 ]
                                 + SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(0, 0, 4, 0)
+                                [
+                                    SNew(SButton)
+                                        .IsEnabled_Lambda([]() { return !FVideoMatchAllJob::IsRunning(); })
+                                        .OnClicked(this, &SEditingSessionWindow::OnMatchAllVideos)
+                                        [
+                                            AddIconAndTextHere(TEXT("Icons.Search"), TEXT("Match all videos"), false, true)
+                                        ]
+                                ]
+                                + SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(0, 0, 4, 0)
                                 [
                                     SNew(SButton)
                                         .OnClicked(this, &SEditingSessionWindow::OnExportFolder)
@@ -635,7 +590,7 @@ TSharedRef<SWidget> SEditingSessionWindow::BuildProgressBarSection()
 
 TSharedRef<SWidget> SEditingSessionWindow::BuildQueueList()
 {
-    return SAssignNew(ListView, SListView<TSharedPtr<FQueuedAnim>>)
+    return SAssignNew(ListView, SListView<TSharedPtr<FQueueRowItem>>)
         .ListItemsSource(&Rows)
         .OnGenerateRow(this, &SEditingSessionWindow::OnMakeRow)
         .SelectionMode(ESelectionMode::None);
@@ -664,6 +619,8 @@ void SEditingSessionWindow::LoadSettings()
     if (!VideoFolderPath.IsEmpty())
         SelectedVideoFolder = VideoFolderPath;
 
+    FVideoFolderIndex::Get().SetRootFolder(SelectedVideoFolder);
+
     BakeSaveToFolder = BakeSaveToFolderPath.IsEmpty() ? FOutputHelper::Get() : BakeSaveToFolderPath;
 }
 
@@ -691,17 +648,123 @@ void SEditingSessionWindow::RefreshQueue()
 {
     Rows.Reset();
     const auto& All = FSeqQueue::Get().GetAll();
+    Rows.Reserve(All.Num());
     for (const auto& Q : All)
-        Rows.Add(MakeShared<FQueuedAnim>(Q));
+    {
+        TSharedPtr<FQueueRowItem> Row = MakeShared<FQueueRowItem>();
+        Row->Anim = Q;
+        Row->Index = Rows.Num();
+        Rows.Add(Row);
+    }
+
+    if (ListView.IsValid())
+        ListView->RequestListRefresh();
+}
+
+void SEditingSessionWindow::OnQueueItemsChanged(const FSeqQueueChange& Change)
+{
+    const auto& All = FSeqQueue::Get().GetAll();
+    const int32 End = Change.Index + Change.Count;
+
+    // Patch the mirrored rows in place so untouched rows keep their pointers and widgets
+    switch (Change.Type)
+    {
+    case FSeqQueueChange::EType::Inserted:
+        if (Change.Index > Rows.Num() || End > All.Num())
+        {
+            RefreshQueue();
+            return;
+        }
+        Rows.Reserve(Rows.Num() + Change.Count);
+        for (int32 Index = Change.Index; Index < End; ++Index)
+        {
+            TSharedPtr<FQueueRowItem> Row = MakeShared<FQueueRowItem>();
+            Row->Anim = All[Index];
+            Rows.Insert(Row, Index);
+        }
+        ReindexRowsFrom(Change.Index);
+        break;
+
+    case FSeqQueueChange::EType::Removed:
+        if (End > Rows.Num())
+        {
+            RefreshQueue();
+            return;
+        }
+        Rows.RemoveAt(Change.Index, Change.Count);
+        ReindexRowsFrom(Change.Index);
+        break;
+
+    case FSeqQueueChange::EType::Updated:
+        if (End > Rows.Num() || End > All.Num())
+        {
+            RefreshQueue();
+            return;
+        }
+        for (int32 Index = Change.Index; Index < End; ++Index)
+        {
+            Rows[Index]->Anim = All[Index];
+            ++Rows[Index]->Version;
+        }
+        break;
+
+    default:
+        RefreshQueue();
+        return;
+    }
 
     if (ListView.IsValid())
         ListView->RequestListRefresh();
 }
 
+void SEditingSessionWindow::ReindexRowsFrom(int32 FirstIndex)
+{
+    for (int32 Index = FMath::Max(FirstIndex, 0); Index < Rows.Num(); ++Index)
+        Rows[Index]->Index = Index;
+}
+
+const FQueueRowItem& SEditingSessionWindow::GetRowPresentation(FQueueRowItem& Row) const
+{
+    const uint32 CheckpointGeneration = FCheckpointExistenceCache::Get().GetGeneration();
+    if (Row.CachedVersion == Row.Version && Row.CachedCheckpointGeneration == CheckpointGeneration)
+        return Row;
+
+    const bool bIsCurrent = Row.Index == FSeqQueue::Get().GetCurrentIndex();
+    const bool bProcessed = IsQueuedAnimProcessed(Row.Anim);
+    const bool bNoVideoMatch = Row.Anim.HasVideoMatchResult() && Row.Anim.MatchedVideoPath.IsEmpty();
+    Row.bCachedCheckpointed = IsQueuedAnimCheckpointed(Row.Anim);
+
+    FString Label = Row.Anim.DisplayName.ToString();
+    if (bProcessed)
+        Label += TEXT(" (Already processed?)");
+    if (Row.bCachedCheckpointed)
+        Label += TEXT(" (Checkpointed)");
+    if (bNoVideoMatch)
+        Label += TEXT(" (No confident video match)");
+    if (bIsCurrent)
+        Label += TEXT("  <-- editing");
+    Row.CachedLabel = FText::FromString(Label);
+
+    if (bIsCurrent)
+        Row.CachedColor = FLinearColor(0.2f, 0.4f, 1.0f); // blue highlight
+    else if (bProcessed)
+        Row.CachedColor = FLinearColor::Red;
+    else if (Row.bCachedCheckpointed)
+        Row.CachedColor = FLinearColor::Yellow;
+    else if (bNoVideoMatch)
+        Row.CachedColor = FLinearColor(1.0f, 0.5f, 0.1f); // orange: needs a video picked by hand
+    else
+        Row.CachedColor = FLinearColor::White;
+
+    Row.CachedVersion = Row.Version;
+    Row.CachedCheckpointGeneration = CheckpointGeneration;
+    return Row;
+}
+
 TSharedRef<ITableRow> SEditingSessionWindow::OnMakeRow(
-    TSharedPtr<FQueuedAnim> Item, const TSharedRef<STableViewBase>& Owner)
+    TSharedPtr<FQueueRowItem> Item, const TSharedRef<STableViewBase>& Owner)
 {
-    return SNew(STableRow<TSharedPtr<FQueuedAnim>>, Owner)
+    return SNew(STableRow<TSharedPtr<FQueueRowItem>>, Owner)
         [
             SNew(SHorizontalBox)
                 + SHorizontalBox::Slot()
@@ -711,17 +774,15 @@ TSharedRef<ITableRow> SEditingSessionWindow::OnMakeRow(
                     // Load this specific animation
                     SNew(SButton)
                         .Text(FText::FromString(TEXT("->")))
-                        .IsEnabled_Lambda([this, Item]() {
-                        int32 RowIndex = Rows.IndexOfByKey(Item);
-                        return RowIndex != FSeqQueue::Get().GetCurrentIndex(); // disable for current
+                        .IsEnabled_Lambda([Item]() {
+                        return Item->Index != FSeqQueue::Get().GetCurrentIndex(); // disable for current
                             })
                         .OnClicked_Lambda([this, Item]() {
-                        int32 RowIndex = Rows.IndexOfByKey(Item);
+                        const int32 RowIndex = Item->Index;
                         if (RowIndex != INDEX_NONE)
                         {
                             FSeqQueue::Get().SetCurrentIndex(RowIndex);
                             LoadAnimationAtIndex(RowIndex);
-                            RefreshQueue();
                         }
                         return FReply::Handled();
                             })
@@ -733,40 +794,10 @@ TSharedRef<ITableRow> SEditingSessionWindow::OnMakeRow(
                 [
                     SNew(STextBlock)
                         .Text_Lambda([this, Item]() {
-                        if (!Item.IsValid())
-                            return FText::GetEmpty();
-
-                        int32 RowIndex = Rows.IndexOfByKey(Item);
-                        FString Label = Item->DisplayName.ToString();
-
-                        if (IsQueuedAnimProcessed(*Item))
-                            Label += TEXT(" (Already processed?)");
-
-                        FString CheckpointPath;
-                        if (TryGetCheckpointPath(*Item, CheckpointPath))
-                            Label += TEXT(" (Checkpointed)");
-
-                        if (RowIndex == FSeqQueue::Get().GetCurrentIndex())
-                            Label += TEXT("  <-- editing");
-
-                        return FText::FromString(Label);
+                        return GetRowPresentation(*Item).CachedLabel;
                             })
                         .ColorAndOpacity_Lambda([this, Item]() {
-                        if (!Item.IsValid())
-                            return FLinearColor::White;
-
-                        int32 RowIndex = Rows.IndexOfByKey(Item);
-                        if (RowIndex == FSeqQueue::Get().GetCurrentIndex())
-                            return FLinearColor(0.2f, 0.4f, 1.0f); // blue highlight
-
-                        if (IsQueuedAnimProcessed(*Item))
-                            return FLinearColor::Red;
-
-                        FString CheckpointPath;
-                        if (TryGetCheckpointPath(*Item, CheckpointPath))
-                            return FLinearColor::Yellow;
-
-                        return FLinearColor::White;
+                        return FSlateColor(GetRowPresentation(*Item).CachedColor);
                             })
                 ]
 
@@ -777,21 +808,20 @@ TSharedRef<ITableRow> SEditingSessionWindow::OnMakeRow(
                 [
                     SNew(SButton)
                         .Text(FText::FromString(TEXT("Continue from checkpoint")))
-                        .Visibility_Lambda([Item]() {
+                        .Visibility_Lambda([this, Item]() {
                         if (!Item.IsValid())
                             return EVisibility::Collapsed;
-                        return IsQueuedAnimCheckpointed(*Item)
+                        return GetRowPresentation(*Item).bCachedCheckpointed
                             ? EVisibility::Visible
                             : EVisibility::Collapsed;
                             })
                         .OnClicked_Lambda([this, Item]() {
                         if (Item.IsValid())
                         {
-                            int32 RowIndex = Rows.IndexOfByKey(Item);
+                            const int32 RowIndex = Item->Index;
                             if (RowIndex != INDEX_NONE)
                             {
                                 ContinueFromCheckpointAtIndex(RowIndex);
-                                RefreshQueue();
                             }
                         }
                         return FReply::Handled();
@@ -807,20 +837,19 @@ TSharedRef<ITableRow> SEditingSessionWindow::OnMakeRow(
                         .Visibility_Lambda([Item]() {
                         if (!Item.IsValid())
                             return EVisibility::Collapsed;
-                        return IsQueuedAnimProcessed(*Item)
+                        return IsQueuedAnimProcessed(Item->Anim)
                             ? EVisibility::Visible
                             : EVisibility::Collapsed;
                             })
                         .OnClicked_Lambda([this, Item]() {
                         if (Item.IsValid())
                         {
-                            UObject* Asset = UEditorAssetLibrary::LoadAsset(Item->Path.ToString());
+                            UObject* Asset = UEditorAssetLibrary::LoadAsset(Item->Anim.Path.ToString());
                             if (Asset)
                             {
                                 UEditorAssetLibrary::SetMetadataTag(Asset, TEXT("Processed"), TEXT("False"));
                                 UEditorAssetLibrary::SaveLoadedAsset(Asset);
-                                FSeqQueue::Get().SetProcessed(Item->Path, false);
-                                RefreshQueue();
+                                FSeqQueue::Get().SetProcessed(Item->Anim.Path, false);
                             }
                         }
                         return FReply::Handled();
@@ -834,20 +863,10 @@ TSharedRef<ITableRow> SEditingSessionWindow::OnMakeRow(
                     SNew(SButton)
                         .Text(FText::FromString(TEXT("Remove")))
                         .OnClicked_Lambda([Item]() {
-                        const auto& All = FSeqQueue::Get().GetAll();
                         if (!Item.IsValid())
                             return FReply::Handled();
 
-                        int32 Index = INDEX_NONE;
-                        for (int32 i = 0; i < All.Num(); ++i)
-                        {
-                            if (All[i].Path == Item->Path)
-                            {
-                                Index = i;
-                                break;
-                            }
-                        }
-
+                        const int32 Index = FSeqQueue::Get().FindIndexByPath(Item->Anim.Path);
                         if (Index != INDEX_NONE)
                             FSeqQueue::Get().RemoveAt(Index);
 
@@ -964,6 +983,8 @@ FReply SEditingSessionWindow::OnSelectVideoFolder()
     {
         SelectedVideoFolder = SelectedFolder;
         SaveSettings();
+        FVideoFolderIndex::Get().SetRootFolder(SelectedVideoFolder);
+        FSeqQueue::Get().ClearVideoMatches();
         LoadBestMatchedVideoForCurrent();
     }
 
@@ -1148,7 +1169,6 @@ FReply SEditingSessionWindow::OnCheckpointCurrentAnimation()
                         FSeqQueue::Get().SetCheckpoint(FSoftObjectPath(SourceAnimPath), CheckpointPath);
 
                         PickerWindow->RequestDestroyWindow();
-                        RefreshQueue();
                         return FReply::Handled();
                     })
             ]
@@ -1175,21 +1195,7 @@ FReply SEditingSessionWindow::OnLoadNextAnimation()
         return FReply::Handled();
 
     // Determine next index
-    const int32 CurrentIndex = FSeqQueue::Get().GetCurrentIndex();
-    const int32 StartIndex = CurrentIndex == INDEX_NONE ? -1 : CurrentIndex;
-
-    int32 NextUnprocessedIndex = INDEX_NONE;
-
-    for (int32 Offset = 1; Offset <= All.Num(); ++Offset)
-    {
-        const int32 CandidateIndex = (StartIndex + Offset + All.Num()) % All.Num();
-
-        if (!IsQueuedAnimProcessed(All[CandidateIndex]))
-        {
-            NextUnprocessedIndex = CandidateIndex;
-            break;
-        }
-    }
+    const int32 NextUnprocessedIndex = FSeqQueue::Get().FindNextUnprocessed(FSeqQueue::Get().GetCurrentIndex());
 
     if (NextUnprocessedIndex == INDEX_NONE)
     {
@@ -1222,9 +1228,14 @@ FReply SEditingSessionWindow::OnLoadNextAnimation()
         }
     }
 
-    // Load animation asset
-    UObject* AnimObject = All[FSeqQueue::Get().GetCurrentIndex()].Path.TryLoad();
-    
+    // Load animation asset; timed here because the prompts below keep the clip record from opening yet
+    double AnimLoadSeconds = 0.0;
+    UObject* AnimObject = nullptr;
+    {
+        TOUCAN_EARLY_LOAD_PHASE(LoadAnimationAsset, AnimLoadSeconds);
+        AnimObject = All[FSeqQueue::Get().GetCurrentIndex()].Path.TryLoad();
+    }
+
     // Notify if failed to load
     if (!AnimObject)
     {
@@ -1288,11 +1299,13 @@ FReply SEditingSessionWindow::OnLoadNextAnimation()
         return FReply::Handled();
     }
 
+    FScopedLoadClip LoadClip(Anim->GetName(), TEXT("LoadAnimationAsset"), AnimLoadSeconds);
     UObject* RigObj = SelectedRig.LoadSynchronous(); // or TryLoad()
 
     // Delegate to helper
     FEditingSessionSequencerHelper::LoadNextAnimation(SelectedMesh, RigObj, Anim);
     LoadBestMatchedVideoForCurrent();
+    FAnimPreloader::Get().PreloadAfterCurrent();
 
     return FReply::Handled();
 }
@@ -1328,87 +1341,150 @@ FReply SEditingSessionWindow::OnLoadVideoForCurrent()
     return FReply::Handled();
 }
 
-FString SEditingSessionWindow::FindBestMatchedVideoForCurrent() const
+bool SEditingSessionWindow::IsStoredVideoMatchUsable(const FQueuedAnim& Item, const FVideoIndexSnapshot* VideoIndex) const
 {
-    if (SelectedVideoFolder.IsEmpty() || !FPaths::DirectoryExists(SelectedVideoFolder))
+    // A stored match from "Match all videos" wins as long as it points into the selected folder and still exists there
+    return !SelectedVideoFolder.IsEmpty()
+        && !Item.MatchedVideoPath.IsEmpty()
+        && FPaths::IsUnderDirectory(Item.MatchedVideoPath, SelectedVideoFolder)
+        && VideoIndex
+        && VideoIndex->ContainsFile(Item.MatchedVideoPath);
+}
+
+SEditingSessionWindow::FCurrentVideoMatch SEditingSessionWindow::FindBestMatchedVideoForCurrent() const
+{
+    FCurrentVideoMatch Result;
+    if (SelectedVideoFolder.IsEmpty())
     {
-        return FString();
+        return Result;
     }
 
     const auto& All = FSeqQueue::Get().GetAll();
     const int32 CurrentIndex = FSeqQueue::Get().GetCurrentIndex();
     if (!All.IsValidIndex(CurrentIndex))
     {
-        return FString();
+        return Result;
     }
 
     const FQueuedAnim& CurrentAnim = All[CurrentIndex];
     const FString QueueName = CurrentAnim.DisplayName.IsEmpty()
         ? CurrentAnim.Path.GetAssetName()
         : CurrentAnim.DisplayName.ToString();
+    Result.AnimPath = CurrentAnim.Path;
 
-    TArray<FString> CandidateFiles;
-    IFileManager::Get().IterateDirectoryRecursively(*SelectedVideoFolder, [&CandidateFiles](const TCHAR* FilenameOrDirectory, const bool bIsDirectory)
+    // Only the in-memory index is consulted; it is rebuilt and kept current in the background
+    const TSharedPtr<const FVideoIndexSnapshot> VideoIndex = FVideoFolderIndex::Get().GetSnapshot();
+    if (IsStoredVideoMatchUsable(CurrentAnim, VideoIndex.Get()))
     {
-        if (bIsDirectory)
-        {
-            return true;
-        }
-
-        const FString CandidateFile(FilenameOrDirectory);
-        const FString Extension = FPaths::GetExtension(CandidateFile).ToLower();
-        if (Extension == TEXT("mp4") || Extension == TEXT("mov") || Extension == TEXT("mxf") || Extension == TEXT("avi"))
-        {
-            CandidateFiles.Add(CandidateFile);
-        }
-
-        return true;
-    });
+        UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Using stored video match for '%s': %s (score %d)"),
+            *QueueName,
+            *CurrentAnim.MatchedVideoPath,
+            CurrentAnim.MatchedVideoScore);
+        Result.VideoPath = CurrentAnim.MatchedVideoPath;
+        Result.Score = CurrentAnim.MatchedVideoScore;
+        return Result;
+    }
 
-    if (CandidateFiles.IsEmpty())
+    if (!VideoIndex.IsValid())
     {
-        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] No video files found in %s."), *SelectedVideoFolder);
-        return FString();
+        UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Video index for %s is still being built; will match '%s' when it is ready."),
+            *SelectedVideoFolder,
+            *QueueName);
+        Result.bIndexPending = true;
+        return Result;
     }
 
-    FString BestFile;
-    int32 BestScore = 0;
-    for (const FString& CandidateFile : CandidateFiles)
+    if (VideoIndex->Entries.IsEmpty())
     {
-        const int32 Score = ScoreVideoNameMatch(QueueName, FPaths::GetBaseFilename(CandidateFile));
-        if (Score > BestScore)
-        {
-            BestScore = Score;
-            BestFile = CandidateFile;
-        }
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] No video files found in %s."), *SelectedVideoFolder);
+        return Result;
     }
 
-    constexpr int32 MinimumMatchScore = 55;
-    if (BestScore < MinimumMatchScore)
+    constexpr int32 MinimumMatchScore = FVideoNameMatcher::DefaultMinimumScore;
+    const FVideoNameMatcher::FMatch Match = VideoIndex->Matcher->FindBest(FVideoFolderIndex::NormalizeName(QueueName), MinimumMatchScore);
+    Result.bMatched = true;
+    if (Match.EntryIndex == INDEX_NONE)
     {
-        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] No matching video found for '%s' in %s. Best score was %d."),
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] No matching video found for '%s' in %s. No video scored %d or more."),
             *QueueName,
             *SelectedVideoFolder,
-            BestScore);
-        return FString();
+            MinimumMatchScore);
+        return Result;
     }
 
+    Result.VideoPath = VideoIndex->Entries[Match.EntryIndex].FilePath;
+    Result.Score = Match.Score;
+
     UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Matched video for '%s': %s (score %d)"),
         *QueueName,
-        *BestFile,
-        BestScore);
-    return BestFile;
+        *Result.VideoPath,
+        Result.Score);
+    return Result;
+}
+
+void SEditingSessionWindow::OnVideoIndexUpdated()
+{
+    if (bVideoMatchPending)
+    {
+        bVideoMatchPending = false;
+        LoadBestMatchedVideoForCurrent();
+    }
+}
+
+FReply SEditingSessionWindow::OnMatchAllVideos()
+{
+    if (SelectedVideoFolder.IsEmpty())
+    {
+        FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(TEXT("Select a video folder first.")));
+        return FReply::Handled();
+    }
+
+    if (!FVideoMatchAllJob::Start())
+    {
+        FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(TEXT("The video folder is still being indexed. Try again in a moment.")));
+    }
+    return FReply::Handled();
+}
+
+void SEditingSessionWindow::OnAnimationPreloaded(const FSoftObjectPath& Path)
+{
+    // Only the clip "Load next" will pick; items with a checkpoint open from it instead
+    const FSeqQueue& Queue = FSeqQueue::Get();
+    const int32 NextIndex = Queue.FindNextUnprocessed(Queue.GetCurrentIndex());
+    if (!Queue.GetAll().IsValidIndex(NextIndex) || Queue.GetAll()[NextIndex].Path != Path)
+    {
+        return;
+    }
+
+    const FQueuedAnim& Next = Queue.GetAll()[NextIndex];
+    FString CheckpointPath;
+    UAnimSequence* Anim = Cast<UAnimSequence>(Path.ResolveObject());
+    if (!Anim || TryGetCheckpointPath(Next, CheckpointPath))
+    {
+        return;
+    }
+
+    // Same rule as FindBestMatchedVideoForCurrent for stored matches; anything else is matched when the clip is loaded
+    const bool bUseStoredMatch = IsStoredVideoMatchUsable(Next, FVideoFolderIndex::Get().GetSnapshot().Get());
+
+    FEditingSessionSequencerHelper::PrepareNextAnimation(SelectedMesh, SelectedRig.Get(), Anim, bUseStoredMatch ? Next.MatchedVideoPath : FString());
 }
 
 bool SEditingSessionWindow::LoadBestMatchedVideoForCurrent()
 {
-    const FString MatchedVideo = FindBestMatchedVideoForCurrent();
-    if (MatchedVideo.IsEmpty())
+    TOUCAN_LOAD_PHASE(LoadVideo);
+    const FCurrentVideoMatch Match = FindBestMatchedVideoForCurrent();
+    bVideoMatchPending = Match.bIndexPending;
+    if (Match.bMatched)
+    {
+        FSeqQueue::Get().SetVideoMatch(Match.AnimPath, Match.VideoPath, Match.Score);
+    }
+    if (Match.VideoPath.IsEmpty())
     {
         return false;
     }
 
-    FEditingSessionSequencerHelper::LoadVideoForCurrentSequence(MatchedVideo);
+    FEditingSessionSequencerHelper::LoadVideoForCurrentSequence(Match.VideoPath);
     return true;
 }
 
@@ -1430,9 +1506,7 @@ void SEditingSessionWindow::ContinueFromCheckpointAtIndex(int32 TargetIndex)
 
     FSeqQueue::Get().SetCurrentIndex(TargetIndex);
 
-    if (ListView.IsValid())
-        ListView->RebuildList();
-
+    FScopedLoadClip LoadClip(FPaths::GetBaseFilename(CheckpointPath));
     if (!FEditingSessionSequencerHelper::OpenCheckpointSequence(CheckpointPath))
     {
         FMessageDialog::Open(
@@ -1445,6 +1519,7 @@ void SEditingSessionWindow::ContinueFromCheckpointAtIndex(int32 TargetIndex)
         return;
     }
 
+    FAnimPreloader::Get().PreloadAfterCurrent();
     UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Continued queue item %d from checkpoint: %s"), TargetIndex, *CheckpointPath);
 }
 
@@ -1456,10 +1531,12 @@ void SEditingSessionWindow::LoadAnimationAtIndex(int32 TargetIndex)
 
     FSeqQueue::Get().SetCurrentIndex(TargetIndex);
 
-    if (ListView.IsValid())
-        ListView->RebuildList();
-
-    UObject* AnimObject = All[FSeqQueue::Get().GetCurrentIndex()].Path.TryLoad();
+    double AnimLoadSeconds = 0.0;
+    UObject* AnimObject = nullptr;
+    {
+        TOUCAN_EARLY_LOAD_PHASE(LoadAnimationAsset, AnimLoadSeconds);
+        AnimObject = All[FSeqQueue::Get().GetCurrentIndex()].Path.TryLoad();
+    }
 
     if (!AnimObject)
     {
@@ -1525,10 +1602,12 @@ void SEditingSessionWindow::LoadAnimationAtIndex(int32 TargetIndex)
         return;
     }
 
+    FScopedLoadClip LoadClip(Anim->GetName(), TEXT("LoadAnimationAsset"), AnimLoadSeconds);
     UObject* RigObj = SelectedRig.LoadSynchronous();
 
     FEditingSessionSequencerHelper::LoadNextAnimation(SelectedMesh, RigObj, Anim);
     LoadBestMatchedVideoForCurrent();
+    FAnimPreloader::Get().PreloadAfterCurrent();
 
     UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Loaded animation at index %d: %s"), FSeqQueue::Get().GetCurrentIndex(), *Anim->GetName());
 }
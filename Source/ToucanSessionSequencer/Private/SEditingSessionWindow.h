@@ -9,6 +9,23 @@
 #include "Brushes/SlateImageBrush.h"
 #include "Interfaces/IPluginManager.h"
 
+struct FVideoIndexSnapshot;
+
+/** One row of the queue list: a copy of the queued item, where it sits, and its cached presentation */
+struct FQueueRowItem
+{
+    FQueuedAnim Anim;
+    int32 Index = INDEX_NONE; // kept current as rows are inserted and removed
+    uint32 Version = 0; // bumped whenever the queue reports a change for this row
+
+    // Rebuilt only when Version or the checkpoint cache generation moves on
+    uint32 CachedVersion = MAX_uint32;
+    uint32 CachedCheckpointGeneration = MAX_uint32;
+    FText CachedLabel;
+    FLinearColor CachedColor = FLinearColor::White;
+    bool bCachedCheckpointed = false;
+};
+
 /**
  * Editing Session main window.
  * Lets you pick SkeletalMesh & Rig and step through queued animations.
@@ -36,8 +53,11 @@ private:
 
 private:
     // --- internal helpers ---
-    void RefreshQueue();
-    TSharedRef<ITableRow> OnMakeRow(TSharedPtr<FQueuedAnim> Item, const TSharedRef<STableViewBase>& Owner);
+    void RefreshQueue(); // full rebuild of Rows
+    void OnQueueItemsChanged(const FSeqQueueChange& Change);
+    void ReindexRowsFrom(int32 FirstIndex);
+    const FQueueRowItem& GetRowPresentation(FQueueRowItem& Row) const; // refreshes the cached label/colour if stale
+    TSharedRef<ITableRow> OnMakeRow(TSharedPtr<FQueueRowItem> Item, const TSharedRef<STableViewBase>& Owner);
 
     FReply OnSelectSkeletalMesh();
     FReply OnSelectRig();
@@ -48,8 +68,20 @@ private:
     FReply OnCheckpointCurrentAnimation();
     FReply OnLoadNextAnimation();
     FReply OnLoadVideoForCurrent();
+    FReply OnMatchAllVideos();
     bool LoadBestMatchedVideoForCurrent();
-    FString FindBestMatchedVideoForCurrent() const;
+    struct FCurrentVideoMatch
+    {
+        FSoftObjectPath AnimPath;
+        FString VideoPath; // empty if nothing matched
+        int32 Score = 0;
+        bool bMatched = false; // freshly matched against the index, to be recorded on the queue item
+        bool bIndexPending = false; // the index is still being built; match again when it is published
+    };
+    FCurrentVideoMatch FindBestMatchedVideoForCurrent() const;
+    bool IsStoredVideoMatchUsable(const FQueuedAnim& Item, const FVideoIndexSnapshot* VideoIndex) const;
+    void OnVideoIndexUpdated(); // retries a match that found the index still building
+    void OnAnimationPreloaded(const FSoftObjectPath& Path); // builds the next clip into the standby sequence
 
     FString GetCurrentConfiguredOutputFolder() const;
     void ExportAnimSequencesToFolder(const FString& sourceContentFolder, const FString& outputDiskFolder) const;
@@ -59,12 +91,13 @@ private:
     void ContinueFromCheckpointAtIndex(int32 TargetIndex);
 
 private:
-    TArray<TSharedPtr<FQueuedAnim>> Rows;
-    TSharedPtr<SListView<TSharedPtr<FQueuedAnim>>> ListView;
+    TArray<TSharedPtr<FQueueRowItem>> Rows;
+    TSharedPtr<SListView<TSharedPtr<FQueueRowItem>>> ListView;
 
     TSoftObjectPtr<USkeletalMesh> SelectedMesh;
     TSoftObjectPtr<UObject> SelectedRig;
     FString SelectedVideoFolder;
+    bool bVideoMatchPending = false;
     FString BakeSaveToFolder;
 
     // Config keys
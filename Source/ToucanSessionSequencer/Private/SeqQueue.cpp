@@ -1,10 +1,109 @@
 #include "SeqQueue.h"
 #include "Misc/ConfigCacheIni.h"
 #include "AssetRegistry/AssetData.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "SeqQueueWriter.h"
+
+namespace
+{
+    // Line-delimited journal: one tab-separated record per mutation, compacted into a snapshot now and then
+    constexpr const TCHAR* JournalHeader = TEXT("TOUCANQ\t1");
+    constexpr int32 MinRecordsBeforeCompaction = 4096;
+    constexpr float DefaultPersistCoalesceSeconds = 0.25f;
+    constexpr int32 MaxPendingChanges = 64; // past this a listener is better off rebuilding
+
+    FString GetJournalPath()
+    {
+        return FPaths::ProjectSavedDir() / TEXT("ToucanSessionSequencer/Queue.journal");
+    }
+
+    FString SanitizeField(const FString& In)
+    {
+        FString Out = In;
+        Out.ReplaceCharInline(TEXT('\t'), TEXT(' '));
+        Out.ReplaceCharInline(TEXT('\r'), TEXT(' '));
+        Out.ReplaceCharInline(TEXT('\n'), TEXT(' '));
+        return Out;
+    }
+}
+
+FSeqQueue::FSeqQueue()
+{
+#if WITH_EDITOR
+    const FString& Ini = GEditorPerProjectIni;
+#else
+    const FString& Ini = GGameIni;
+#endif
+    float CoalesceSeconds = DefaultPersistCoalesceSeconds;
+    GConfig->GetFloat(SeqCfg::Section, SeqCfg::PersistCoalesceSecondsKey, CoalesceSeconds, Ini);
+    Writer = MakeUnique<FSeqQueueWriter>(GetJournalPath(), CoalesceSeconds);
+
+    Load();
+}
+
+FSeqQueue::FSeqQueue(EScratch)
+    : bInMemoryOnly(true)
+{
+}
+
+FSeqQueue::~FSeqQueue() = default;
+
+TUniquePtr<FSeqQueue> FSeqQueue::CreateScratch()
+{
+    return TUniquePtr<FSeqQueue>(new FSeqQueue(EScratch::Scratch));
+}
+
+void FSeqQueue::FlushNow()
+{
+    FlushJournal();
+    if (Writer)
+    {
+        Writer->FlushNow();
+    }
+}
+
+void FSeqQueue::ShutdownPersistence()
+{
+    FlushJournal();
+    Writer.Reset(); // joins the worker and writes whatever it had left
+}
 
 void FSeqQueue::Load()
 {
-    Items.Reset();
+    ResetItems();
+    PendingJournal.Reset();
+    RecordsSinceCompaction = 0;
+    RecordChange(FSeqQueueChange::EType::Reset, 0);
+    if (bInMemoryOnly)
+    {
+        return;
+    }
+
+    TArray<FString> Lines;
+    if (FFileHelper::LoadFileToStringArray(Lines, *GetJournalPath()))
+    {
+        for (const FString& Line : Lines)
+        {
+            ReplayRecord(Line);
+        }
+        RecordsSinceCompaction = Lines.Num();
+
+        CurrentIndex = CheckBoundsIndex(CurrentIndex) ? CurrentIndex : INDEX_NONE;
+        if (RecordsSinceCompaction > GetCompactionThreshold())
+        {
+            Save();
+        }
+    }
+    else
+    {
+        MigrateFromConfig();
+    }
+}
+
+void FSeqQueue::MigrateFromConfig()
+{
     TArray<FString> Paths;
     TArray<FString> ProcessedPaths;
     TArray<FString> CheckpointEntries;
@@ -48,44 +147,79 @@ void FSeqQueue::Load()
             Q.bCheckpointed = true;
             Q.CheckpointPath = *CheckpointPath;
         }
-        Items.Add(MoveTemp(Q));
+        AppendUnique(MoveTemp(Q));
     }
 
     CurrentIndex = CheckBoundsIndex(CurrentIndex) ? CurrentIndex : INDEX_NONE;
-    
-    CachedProcessedCount = -1; // Invalidate cache on load
+
+    // One-time migration: once the journal exists the old ini keys are never read again
+    Save();
+    if (Writer)
+    {
+        Writer->FlushNow();
+    }
+    if (FPaths::FileExists(GetJournalPath()))
+    {
+        GConfig->RemoveKey(SeqCfg::Section, SeqCfg::Key, Ini);
+        GConfig->RemoveKey(SeqCfg::Section, TEXT("ProcessedQueue"), Ini);
+        GConfig->RemoveKey(SeqCfg::Section, TEXT("CheckpointQueue"), Ini);
+        GConfig->RemoveKey(SeqCfg::Section, SeqCfg::CurrentIndexKey, Ini);
+        GConfig->Flush(false, Ini);
+
+        if (Items.Num() > 0)
+        {
+            UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Migrated %d queue items from config to %s"), Items.Num(), *GetJournalPath());
+        }
+    }
 }
 
-void FSeqQueue::Save() const
+void FSeqQueue::Save()
 {
-    TArray<FString> Paths;
-    TArray<FString> ProcessedPaths;
-    TArray<FString> CheckpointEntries;
-    Paths.Reserve(Items.Num());
-    for (const auto& Q : Items)
+    if (bInMemoryOnly)
+    {
+        PendingJournal.Reset();
+        RecordsSinceCompaction = 0;
+        return;
+    }
+
+    TStringBuilder<4096> Snapshot;
+    Snapshot << JournalHeader << TEXT("\n");
+    int32 RecordCount = 1;
+    for (const FQueuedAnim& Q : Items)
     {
         const FString PathString = Q.Path.ToString();
-        Paths.Add(PathString);
+        Snapshot << TEXT("A\t") << PathString << TEXT("\t") << SanitizeField(Q.DisplayName.ToString()) << TEXT("\n");
+        ++RecordCount;
         if (Q.bProcessed)
         {
-            ProcessedPaths.Add(PathString);
+            Snapshot << TEXT("P\t") << PathString << TEXT("\t1\n");
+            ++RecordCount;
         }
         if (Q.bCheckpointed && !Q.CheckpointPath.IsEmpty())
         {
-            CheckpointEntries.Add(PathString + TEXT("=") + Q.CheckpointPath);
+            Snapshot << TEXT("K\t") << PathString << TEXT("\t") << SanitizeField(Q.CheckpointPath) << TEXT("\n");
+            ++RecordCount;
+        }
+        if (Q.HasVideoMatchResult())
+        {
+            Snapshot << TEXT("V\t") << PathString << TEXT("\t") << Q.MatchedVideoScore << TEXT("\t") << SanitizeField(Q.MatchedVideoPath) << TEXT("\n");
+            ++RecordCount;
         }
     }
+    Snapshot << TEXT("I\t") << CurrentIndex << TEXT("\n");
+    ++RecordCount;
 
-#if WITH_EDITOR
-    const FString& Ini = GEditorPerProjectIni;
-#else
-    const FString& Ini = GGameIni;
-#endif
-    GConfig->SetArray(SeqCfg::Section, SeqCfg::Key, Paths, Ini);
-    GConfig->SetArray(SeqCfg::Section, TEXT("ProcessedQueue"), ProcessedPaths, Ini);
-    GConfig->SetArray(SeqCfg::Section, TEXT("CheckpointQueue"), CheckpointEntries, Ini);
-    GConfig->SetInt(SeqCfg::Section, SeqCfg::CurrentIndexKey, CurrentIndex, Ini);
-    GConfig->Flush(false, Ini);
+    if (Writer)
+    {
+        Writer->Replace(FString(Snapshot.ToView()));
+    }
+    else if (!FSeqQueueWriter::ReplaceOnDisk(GetJournalPath(), FString(Snapshot.ToView())))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Failed to write queue journal: %s"), *GetJournalPath());
+    }
+
+    PendingJournal.Reset();
+    RecordsSinceCompaction = RecordCount;
 }
 
 FText FSeqQueue::MakeDisplayName(const FAssetData& A)
@@ -104,12 +238,11 @@ void FSeqQueue::Add(const FAssetData& A)
     FQueuedAnim Q;
     Q.Path = A.ToSoftObjectPath();
     Q.DisplayName = MakeDisplayName(A);
-    if (!Items.Contains(Q))
+    if (AppendUnique(MoveTemp(Q)))
     {
-        Items.Add(MoveTemp(Q));
-        CachedProcessedCount = -1; // Invalidate cache
-        Save();
-        QueueChanged.Broadcast();
+        JournalAdd(Items.Last());
+        RecordChange(FSeqQueueChange::EType::Inserted, Items.Num() - 1);
+        CommitChange();
     }
 }
 
@@ -117,87 +250,250 @@ void FSeqQueue::AddPath(const FSoftObjectPath& P, const FText& Nice)
 {
     if (!P.IsValid()) return;
     FQueuedAnim Q; Q.Path = P; Q.DisplayName = Nice;
-    if (!Items.Contains(Q))
+    if (AppendUnique(MoveTemp(Q)))
     {
-        Items.Add(MoveTemp(Q));
-        CachedProcessedCount = -1; // Invalidate cache
-        Save();
-        QueueChanged.Broadcast();
+        JournalAdd(Items.Last());
+        RecordChange(FSeqQueueChange::EType::Inserted, Items.Num() - 1);
+        CommitChange();
     }
 }
 
+int32 FSeqQueue::AddBatch(const TArray<FAssetData>& Assets)
+{
+    const int32 FirstNewIndex = Items.Num();
+    Items.Reserve(Items.Num() + Assets.Num());
+    PathToIndex.Reserve(Items.Num() + Assets.Num());
+    for (const FAssetData& A : Assets)
+    {
+        if (!A.IsValid()) continue;
+
+        FQueuedAnim Q;
+        Q.Path = A.ToSoftObjectPath();
+        if (PathToIndex.Contains(Q.Path)) continue;
+
+        Q.DisplayName = MakeDisplayName(A);
+        if (AppendUnique(MoveTemp(Q)))
+        {
+            JournalAdd(Items.Last());
+        }
+    }
+
+    const int32 Added = Items.Num() - FirstNewIndex;
+    if (Added > 0)
+    {
+        RecordChange(FSeqQueueChange::EType::Inserted, FirstNewIndex, Added);
+        CommitChange();
+    }
+    return Added;
+}
+
 bool FSeqQueue::RemoveAt(int32 Index)
 {
     if (!Items.IsValidIndex(Index)) return false;
-    Items.RemoveAt(Index);
-    if (CurrentIndex == Index)
+    JournalRecord(TEXT("R\t") + Items[Index].Path.ToString());
+    RemoveItemAt(Index);
+    RecordChange(FSeqQueueChange::EType::Removed, Index);
+    CommitChange();
+    return true;
+}
+
+int32 FSeqQueue::RemoveAll(TFunctionRef<bool(const FQueuedAnim&)> Predicate)
+{
+    // Compact in place, remembering where the current item ends up
+    int32 WriteIndex = 0;
+    int32 NewCurrentIndex = INDEX_NONE;
+    for (int32 ReadIndex = 0; ReadIndex < Items.Num(); ++ReadIndex)
     {
-        CurrentIndex = INDEX_NONE;
+        if (Predicate(Items[ReadIndex]))
+        {
+            continue;
+        }
+
+        if (ReadIndex == CurrentIndex)
+        {
+            NewCurrentIndex = WriteIndex;
+        }
+        if (WriteIndex != ReadIndex)
+        {
+            Items[WriteIndex] = MoveTemp(Items[ReadIndex]);
+        }
+        ++WriteIndex;
     }
-    else if (CurrentIndex > Index)
+
+    const int32 Removed = Items.Num() - WriteIndex;
+    if (Removed == 0)
     {
-        --CurrentIndex;
+        return 0;
     }
 
-    CurrentIndex = CheckBoundsIndex(CurrentIndex) ? CurrentIndex : INDEX_NONE;
-    CachedProcessedCount = -1; // Invalidate cache
+    Items.SetNum(WriteIndex);
+    CurrentIndex = NewCurrentIndex;
+    RebuildDerivedState();
+    RecordChange(FSeqQueueChange::EType::Reset, 0);
+
+    // One snapshot is cheaper than a journal record per removed item
     Save();
-    QueueChanged.Broadcast();
-    return true;
+    CommitChange();
+    return Removed;
 }
 
 void FSeqQueue::Clear()
 {
-    Items.Reset();
-    CurrentIndex = INDEX_NONE;
-    CachedProcessedCount = 0; // Empty queue = 0 processed
-    Save();
-    QueueChanged.Broadcast();
+    ResetItems();
+    RecordChange(FSeqQueueChange::EType::Reset, 0);
+    JournalRecord(TEXT("X"));
+    CommitChange();
 }
 
 void FSeqQueue::SetCurrentIndex(int32 NewIndex)
 {
     // Check if NewIndex is in range. We set INDEX_NONE if not valid.
+    const int32 OldIndex = CurrentIndex;
     CurrentIndex = CheckBoundsIndex(NewIndex) ? NewIndex : INDEX_NONE;
-    Save();
+
+    // Only the rows losing and gaining the highlight need repainting
+    if (CheckBoundsIndex(OldIndex))
+    {
+        RecordChange(FSeqQueueChange::EType::Updated, OldIndex);
+    }
+    if (CheckBoundsIndex(CurrentIndex) && CurrentIndex != OldIndex)
+    {
+        RecordChange(FSeqQueueChange::EType::Updated, CurrentIndex);
+    }
+    JournalRecord(FString::Printf(TEXT("I\t%d"), CurrentIndex));
+    CommitChange();
+}
+
+void FSeqQueue::RefreshProcessedCount()
+{
+    // Counters are kept up to date on every transition; this only asks the UI to refresh
     QueueChanged.Broadcast();
 }
 
-int32 FSeqQueue::GetProcessedCount()
+int32 FSeqQueue::FindNextUnprocessed(int32 StartIndex) const
 {
-    // Return cached value if valid
-    if (CachedProcessedCount >= 0)
+    // Same order as stepping forward from StartIndex and wrapping around, StartIndex itself last
+    const int32 From = CheckBoundsIndex(StartIndex) ? StartIndex + 1 : 0;
+    if (From < ProcessedBits.Num())
     {
-        return CachedProcessedCount;
+        const int32 Found = ProcessedBits.FindFrom(false, From);
+        if (Found != INDEX_NONE)
+        {
+            return Found;
+        }
     }
 
-    // Cache is invalid, recalculate from queue state without loading every animation.
-    int32 Count = 0;
-    for (const FQueuedAnim& Item : Items)
+    const int32 Wrapped = ProcessedBits.Find(false);
+    return Wrapped < From ? Wrapped : INDEX_NONE;
+}
+
+int32 FSeqQueue::FindIndexByPath(const FSoftObjectPath& Path) const
+{
+    const int32* Index = PathToIndex.Find(Path);
+    return Index ? *Index : INDEX_NONE;
+}
+
+bool FSeqQueue::AppendUnique(FQueuedAnim&& Q)
+{
+    // Existing entries always point below Items.Num(), so a different value means a duplicate
+    const int32 NewIndex = Items.Num();
+    if (PathToIndex.FindOrAdd(Q.Path, NewIndex) != NewIndex)
     {
-        if (Item.bProcessed)
-        {
-            ++Count;
-        }
+        return false;
     }
-    
-    CachedProcessedCount = Count;
-    return Count;
+
+    ProcessedBits.Add(Q.bProcessed);
+    CheckpointedBits.Add(Q.bCheckpointed);
+    ProcessedCount += Q.bProcessed ? 1 : 0;
+    CheckpointedCount += Q.bCheckpointed ? 1 : 0;
+    Items.Add(MoveTemp(Q));
+    return true;
 }
 
-void FSeqQueue::RefreshProcessedCount()
+void FSeqQueue::ReindexFrom(int32 FirstIndex)
 {
-    // Invalidate cache to force recalculation on next GetProcessedCount()
-    CachedProcessedCount = -1;
-    QueueChanged.Broadcast(); // Trigger UI refresh
+    for (int32 Index = FMath::Max(FirstIndex, 0); Index < Items.Num(); ++Index)
+    {
+        PathToIndex.Add(Items[Index].Path, Index);
+    }
 }
 
-int32 FSeqQueue::FindIndexByPath(const FSoftObjectPath& Path) const
+void FSeqQueue::RebuildDerivedState()
+{
+    PathToIndex.Reset();
+    ProcessedBits.Init(false, Items.Num());
+    CheckpointedBits.Init(false, Items.Num());
+    ProcessedCount = 0;
+    CheckpointedCount = 0;
+
+    for (int32 Index = 0; Index < Items.Num(); ++Index)
+    {
+        const FQueuedAnim& Q = Items[Index];
+        PathToIndex.Add(Q.Path, Index);
+        ProcessedBits[Index] = Q.bProcessed;
+        CheckpointedBits[Index] = Q.bCheckpointed;
+        ProcessedCount += Q.bProcessed ? 1 : 0;
+        CheckpointedCount += Q.bCheckpointed ? 1 : 0;
+    }
+}
+
+void FSeqQueue::RemoveItemAt(int32 Index)
+{
+    ProcessedCount -= ProcessedBits[Index] ? 1 : 0;
+    CheckpointedCount -= CheckpointedBits[Index] ? 1 : 0;
+    ProcessedBits.RemoveAt(Index);
+    CheckpointedBits.RemoveAt(Index);
+    PathToIndex.Remove(Items[Index].Path);
+    Items.RemoveAt(Index);
+    ReindexFrom(Index);
+    if (CurrentIndex == Index)
+    {
+        CurrentIndex = INDEX_NONE;
+    }
+    else if (CurrentIndex > Index)
+    {
+        --CurrentIndex;
+    }
+
+    CurrentIndex = CheckBoundsIndex(CurrentIndex) ? CurrentIndex : INDEX_NONE;
+}
+
+void FSeqQueue::ResetItems()
 {
-    return Items.IndexOfByPredicate([&Path](const FQueuedAnim& Item)
+    Items.Reset();
+    PathToIndex.Reset();
+    ProcessedBits.Empty();
+    CheckpointedBits.Empty();
+    ProcessedCount = 0;
+    CheckpointedCount = 0;
+    CurrentIndex = INDEX_NONE;
+}
+
+void FSeqQueue::ApplyProcessed(int32 Index, bool bProcessed)
+{
+    if (ProcessedBits[Index] != bProcessed)
     {
-        return Item.Path == Path;
-    });
+        ProcessedBits[Index] = bProcessed;
+        ProcessedCount += bProcessed ? 1 : -1;
+    }
+    Items[Index].bProcessed = bProcessed;
+
+    if (bProcessed)
+    {
+        ApplyCheckpoint(Index, FString());
+    }
+}
+
+void FSeqQueue::ApplyCheckpoint(int32 Index, const FString& CheckpointPath)
+{
+    const bool bCheckpointed = !CheckpointPath.IsEmpty();
+    if (CheckpointedBits[Index] != bCheckpointed)
+    {
+        CheckpointedBits[Index] = bCheckpointed;
+        CheckpointedCount += bCheckpointed ? 1 : -1;
+    }
+    Items[Index].bCheckpointed = bCheckpointed;
+    Items[Index].CheckpointPath = CheckpointPath;
 }
 
 bool FSeqQueue::IsProcessed(const FSoftObjectPath& Path) const
@@ -228,19 +524,27 @@ void FSeqQueue::SetProcessed(const FSoftObjectPath& Path, bool bProcessed)
         return;
     }
 
-    Items[Index].bProcessed = bProcessed;
-    if (bProcessed)
+    ApplyProcessed(Index, bProcessed);
+    RecordChange(FSeqQueueChange::EType::Updated, Index);
+    JournalRecord(FString::Printf(TEXT("P\t%s\t%d"), *Path.ToString(), bProcessed ? 1 : 0));
+    CommitChange();
+}
+
+void FSeqQueue::SetCheckpoint(const FSoftObjectPath& Path, const FString& CheckpointPath)
+{
+    const int32 Index = FindIndexByPath(Path);
+    if (!Items.IsValidIndex(Index))
     {
-        Items[Index].bCheckpointed = false;
-        Items[Index].CheckpointPath.Reset();
+        return;
     }
 
-    CachedProcessedCount = -1;
-    Save();
-    QueueChanged.Broadcast();
+    ApplyCheckpoint(Index, CheckpointPath);
+    RecordChange(FSeqQueueChange::EType::Updated, Index);
+    JournalRecord(TEXT("K\t") + Path.ToString() + TEXT("\t") + SanitizeField(CheckpointPath));
+    CommitChange();
 }
 
-void FSeqQueue::SetCheckpoint(const FSoftObjectPath& Path, const FString& CheckpointPath)
+void FSeqQueue::ClearCheckpoint(const FSoftObjectPath& Path)
 {
     const int32 Index = FindIndexByPath(Path);
     if (!Items.IsValidIndex(Index))
@@ -248,13 +552,13 @@ void FSeqQueue::SetCheckpoint(const FSoftObjectPath& Path, const FString& Checkp
         return;
     }
 
-    Items[Index].bCheckpointed = !CheckpointPath.IsEmpty();
-    Items[Index].CheckpointPath = CheckpointPath;
-    Save();
-    QueueChanged.Broadcast();
+    ApplyCheckpoint(Index, FString());
+    RecordChange(FSeqQueueChange::EType::Updated, Index);
+    JournalRecord(TEXT("K\t") + Path.ToString() + TEXT("\t"));
+    CommitChange();
 }
 
-void FSeqQueue::ClearCheckpoint(const FSoftObjectPath& Path)
+void FSeqQueue::SetVideoMatch(const FSoftObjectPath& Path, const FString& VideoPath, int32 Score)
 {
     const int32 Index = FindIndexByPath(Path);
     if (!Items.IsValidIndex(Index))
@@ -262,8 +566,235 @@ void FSeqQueue::ClearCheckpoint(const FSoftObjectPath& Path)
         return;
     }
 
-    Items[Index].bCheckpointed = false;
-    Items[Index].CheckpointPath.Reset();
-    Save();
+    const FQueuedAnim& Q = Items[Index];
+    if (Q.MatchedVideoScore == Score && Q.MatchedVideoPath == VideoPath)
+    {
+        return;
+    }
+
+    ApplyVideoMatch(Index, VideoPath, Score);
+    RecordChange(FSeqQueueChange::EType::Updated, Index);
+    JournalRecord(FString::Printf(TEXT("V\t%s\t%d\t%s"), *Path.ToString(), Score, *SanitizeField(VideoPath)));
+    CommitChange();
+}
+
+void FSeqQueue::ClearVideoMatches()
+{
+    bool bChanged = false;
+    for (int32 Index = 0; Index < Items.Num(); ++Index)
+    {
+        if (Items[Index].HasVideoMatchResult())
+        {
+            ApplyVideoMatch(Index, FString(), INDEX_NONE);
+            bChanged = true;
+        }
+    }
+
+    if (bChanged)
+    {
+        RecordChange(FSeqQueueChange::EType::Reset, 0);
+        Save();
+        CommitChange();
+    }
+}
+
+void FSeqQueue::ApplyVideoMatch(int32 Index, const FString& VideoPath, int32 Score)
+{
+    Items[Index].MatchedVideoPath = VideoPath;
+    Items[Index].MatchedVideoScore = Score;
+}
+
+void FSeqQueue::BeginBatch()
+{
+    ++BatchDepth;
+}
+
+void FSeqQueue::EndBatch()
+{
+    check(BatchDepth > 0);
+    if (--BatchDepth > 0 || !bBatchDirty)
+    {
+        return;
+    }
+
+    bBatchDirty = false;
+    FlushJournal();
+    BroadcastChanges();
+}
+
+void FSeqQueue::CommitChange()
+{
+    if (BatchDepth > 0)
+    {
+        bBatchDirty = true;
+        return;
+    }
+
+    FlushJournal();
+    BroadcastChanges();
+}
+
+void FSeqQueue::RecordChange(FSeqQueueChange::EType Type, int32 Index, int32 Count)
+{
+    using EType = FSeqQueueChange::EType;
+
+    if (PendingChanges.Num() > 0 && PendingChanges[0].Type == EType::Reset)
+    {
+        return; // listeners rebuild anyway
+    }
+
+    if (PendingChanges.Num() > 0 && Type != EType::Reset)
+    {
+        FSeqQueueChange& Last = PendingChanges.Last();
+        if (Type == Last.Type && Type == EType::Inserted && Index == Last.Index + Last.Count)
+        {
+            Last.Count += Count;
+            return;
+        }
+        if (Type == Last.Type && Type == EType::Removed && Index == Last.Index)
+        {
+            Last.Count += Count;
+            return;
+        }
+        if (Type == Last.Type && Type == EType::Updated && Index >= Last.Index && Index <= Last.Index + Last.Count)
+        {
+            Last.Count = FMath::Max(Last.Count, Index + Count - Last.Index);
+            return;
+        }
+
+        // Ranges are replayed against the final Items, so a shift after earlier ranges would point them at the wrong rows
+        if (Type != EType::Updated)
+        {
+            Type = EType::Reset;
+        }
+    }
+
+    if (Type == EType::Reset || PendingChanges.Num() >= MaxPendingChanges)
+    {
+        PendingChanges.Reset();
+        PendingChanges.Add({ EType::Reset, 0, 0 });
+        return;
+    }
+
+    PendingChanges.Add({ Type, Index, Count });
+}
+
+void FSeqQueue::BroadcastChanges()
+{
+    // Listeners may mutate the queue from inside the broadcast, so hand them a detached list
+    const TArray<FSeqQueueChange> Changes = MoveTemp(PendingChanges);
+    PendingChanges.Reset();
+    for (const FSeqQueueChange& Change : Changes)
+    {
+        QueueItemsChanged.Broadcast(Change);
+    }
     QueueChanged.Broadcast();
 }
+
+void FSeqQueue::JournalAdd(const FQueuedAnim& Q)
+{
+    JournalRecord(TEXT("A\t") + Q.Path.ToString() + TEXT("\t") + SanitizeField(Q.DisplayName.ToString()));
+}
+
+void FSeqQueue::JournalRecord(const FString& Record)
+{
+    PendingJournal += Record;
+    PendingJournal += TEXT("\n");
+    ++RecordsSinceCompaction;
+}
+
+void FSeqQueue::FlushJournal()
+{
+    if (PendingJournal.IsEmpty())
+    {
+        return;
+    }
+
+    if (bInMemoryOnly)
+    {
+        PendingJournal.Reset();
+        return;
+    }
+
+    if (RecordsSinceCompaction > GetCompactionThreshold())
+    {
+        Save();
+        return;
+    }
+
+    if (Writer)
+    {
+        Writer->Append(PendingJournal);
+    }
+    else if (!FSeqQueueWriter::AppendToDisk(GetJournalPath(), PendingJournal))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Failed to append to queue journal: %s"), *GetJournalPath());
+    }
+
+    PendingJournal.Reset();
+}
+
+int32 FSeqQueue::GetCompactionThreshold() const
+{
+    // A snapshot holds at most four records per item, so this leaves room for plenty of appends
+    return MinRecordsBeforeCompaction + Items.Num() * 4;
+}
+
+void FSeqQueue::ReplayRecord(const FString& Line)
+{
+    TArray<FString> Fields;
+    Line.ParseIntoArray(Fields, TEXT("\t"), false);
+    if (Fields.Num() == 0)
+    {
+        return;
+    }
+
+    const FString& Type = Fields[0];
+    if (Type == TEXT("A") && Fields.Num() >= 3)
+    {
+        FQueuedAnim Q;
+        Q.Path = FSoftObjectPath(Fields[1]);
+        Q.DisplayName = FText::FromString(Fields[2].IsEmpty() ? Q.Path.GetAssetName() : Fields[2]);
+        AppendUnique(MoveTemp(Q));
+    }
+    else if (Type == TEXT("R") && Fields.Num() >= 2)
+    {
+        const int32 Index = FindIndexByPath(FSoftObjectPath(Fields[1]));
+        if (Items.IsValidIndex(Index))
+        {
+            RemoveItemAt(Index);
+        }
+    }
+    else if (Type == TEXT("X"))
+    {
+        ResetItems();
+    }
+    else if (Type == TEXT("P") && Fields.Num() >= 3)
+    {
+        const int32 Index = FindIndexByPath(FSoftObjectPath(Fields[1]));
+        if (Items.IsValidIndex(Index))
+        {
+            ApplyProcessed(Index, Fields[2] == TEXT("1"));
+        }
+    }
+    else if (Type == TEXT("K") && Fields.Num() >= 3)
+    {
+        const int32 Index = FindIndexByPath(FSoftObjectPath(Fields[1]));
+        if (Items.IsValidIndex(Index))
+        {
+            ApplyCheckpoint(Index, Fields[2]);
+        }
+    }
+    else if (Type == TEXT("V") && Fields.Num() >= 4)
+    {
+        const int32 Index = FindIndexByPath(FSoftObjectPath(Fields[1]));
+        if (Items.IsValidIndex(Index))
+        {
+            ApplyVideoMatch(Index, Fields[3], FCString::Atoi(*Fields[2]));
+        }
+    }
+    else if (Type == TEXT("I") && Fields.Num() >= 2)
+    {
+        CurrentIndex = FCString::Atoi(*Fields[1]);
+    }
+}
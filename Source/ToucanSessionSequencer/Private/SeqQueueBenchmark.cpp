@@ -0,0 +1,96 @@
+#include "AssetRegistry/AssetData.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/PackageName.h"
+#include "SeqQueue.h"
+
+// Times the queue's path lookups on scratch queues of growing size; with the path index every column should stay
+// roughly flat from 100 to 100k items. Never touches the session queue or its journal.
+namespace
+{
+    double NanosecondsPerOp(double StartSeconds, int32 NumOps)
+    {
+        return NumOps > 0 ? (FPlatformTime::Seconds() - StartSeconds) * 1.0e9 / NumOps : 0.0;
+    }
+
+    void RunQueueLookupBenchmark(int32 NumLookups)
+    {
+        const FTopLevelAssetPath AnimClassPath(TEXT("/Script/Engine"), TEXT("AnimSequence"));
+        const int32 Sizes[] = { 100, 1000, 10000, 100000 };
+
+        UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Queue lookup benchmark, %d lookups per size (ns/op):"), NumLookups);
+        UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer]    Items  AddBatch  DuplicateAdd  FindIndexByPath  IsProcessed  SetProcessed"));
+        for (const int32 NumItems : Sizes)
+        {
+            TArray<FAssetData> Assets;
+            Assets.Reserve(NumItems);
+            for (int32 Index = 0; Index < NumItems; ++Index)
+            {
+                const FString AssetName = FString::Printf(TEXT("Bench_Take%06d"), Index);
+                const FString PackageName = FString::Printf(TEXT("/Game/ToucanBenchmark/Shoot%03d/%s"), Index % 100, *AssetName);
+                Assets.Emplace(FName(*PackageName), FName(*FPackageName::GetLongPackagePath(PackageName)), FName(*AssetName), AnimClassPath);
+            }
+
+            // Lookups hit random items so the hash table is not walked in insertion order
+            FRandomStream Random(NumItems);
+            TArray<FSoftObjectPath> Probes;
+            Probes.Reserve(NumLookups);
+            for (int32 Index = 0; Index < NumLookups; ++Index)
+            {
+                Probes.Add(Assets[Random.RandHelper(NumItems)].ToSoftObjectPath());
+            }
+
+            TUniquePtr<FSeqQueue> Queue = FSeqQueue::CreateScratch();
+
+            double Start = FPlatformTime::Seconds();
+            Queue->AddBatch(Assets);
+            const double AddNs = NanosecondsPerOp(Start, NumItems);
+
+            Start = FPlatformTime::Seconds();
+            const int32 NumDuplicatesAdded = Queue->AddBatch(Assets);
+            const double DuplicateNs = NanosecondsPerOp(Start, NumItems);
+
+            int64 IndexSum = 0;
+            Start = FPlatformTime::Seconds();
+            for (const FSoftObjectPath& Path : Probes)
+            {
+                IndexSum += Queue->FindIndexByPath(Path);
+            }
+            const double FindNs = NanosecondsPerOp(Start, Probes.Num());
+
+            int32 NumProcessed = 0;
+            Start = FPlatformTime::Seconds();
+            for (const FSoftObjectPath& Path : Probes)
+            {
+                NumProcessed += Queue->IsProcessed(Path) ? 1 : 0;
+            }
+            const double IsProcessedNs = NanosecondsPerOp(Start, Probes.Num());
+
+            Start = FPlatformTime::Seconds();
+            for (int32 Index = 0; Index < Probes.Num(); ++Index)
+            {
+                Queue->SetProcessed(Probes[Index], (Index & 1) == 0);
+            }
+            const double SetProcessedNs = NanosecondsPerOp(Start, Probes.Num());
+
+            UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] %8d  %8.0f  %12.0f  %15.0f  %11.0f  %12.0f"),
+                NumItems, AddNs, DuplicateNs, FindNs, IsProcessedNs, SetProcessedNs);
+
+            // Keeps the loops above from being optimised away, and flags a broken index
+            if (Queue->GetTotalCount() != NumItems || NumDuplicatesAdded != 0 || IndexSum < 0 || NumProcessed != 0)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Queue benchmark sanity check failed at %d items."), NumItems);
+            }
+        }
+    }
+
+    FAutoConsoleCommand BenchmarkQueueLookupCommand(
+        TEXT("Toucan.BenchmarkQueueLookup"),
+        TEXT("Toucan.BenchmarkQueueLookup [lookups per size = 100000]: ns/op of queue path lookups on scratch queues of 100 to 100k items."),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            const int32 NumLookups = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 10000000) : 100000;
+            RunQueueLookupBenchmark(NumLookups);
+        }));
+}
@@ -0,0 +1,122 @@
+#include "SeqQueueWriter.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+FSeqQueueWriter::FSeqQueueWriter(const FString& InFilePath, float InCoalesceSeconds)
+    : FilePath(InFilePath)
+    , CoalesceSeconds(FMath::Max(InCoalesceSeconds, 0.f))
+{
+    WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+    Thread = FRunnableThread::Create(this, TEXT("ToucanSeqQueueWriter"), 0, TPri_BelowNormal);
+}
+
+FSeqQueueWriter::~FSeqQueueWriter()
+{
+    if (Thread)
+    {
+        Thread->Kill(true); // calls Stop() and waits for Run() to return
+        delete Thread;
+        Thread = nullptr;
+    }
+
+    // Anything queued after the worker's last pass
+    WritePending();
+
+    FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+    WakeEvent = nullptr;
+}
+
+void FSeqQueueWriter::Append(const FString& Records)
+{
+    {
+        FScopeLock Lock(&PendingLock);
+        PendingAppend += Records;
+    }
+    WakeEvent->Trigger();
+}
+
+void FSeqQueueWriter::Replace(const FString& Snapshot)
+{
+    {
+        FScopeLock Lock(&PendingLock);
+        PendingSnapshot = Snapshot;
+        PendingAppend.Reset();
+    }
+    WakeEvent->Trigger();
+}
+
+void FSeqQueueWriter::FlushNow()
+{
+    WritePending();
+}
+
+uint32 FSeqQueueWriter::Run()
+{
+    while (!bStopping)
+    {
+        WakeEvent->Wait();
+        if (bStopping)
+        {
+            break;
+        }
+
+        // Let the rest of a burst (folder import, MIDI scrubbing, ...) pile up before touching the disk
+        if (CoalesceSeconds > 0.f)
+        {
+            FPlatformProcess::Sleep(CoalesceSeconds);
+        }
+
+        WritePending();
+    }
+    return 0;
+}
+
+void FSeqQueueWriter::Stop()
+{
+    bStopping = true;
+    WakeEvent->Trigger();
+}
+
+void FSeqQueueWriter::WritePending()
+{
+    FScopeLock WriteScope(&WriteLock);
+
+    TOptional<FString> Snapshot;
+    FString Records;
+    {
+        FScopeLock Lock(&PendingLock);
+        Snapshot = MoveTemp(PendingSnapshot);
+        PendingSnapshot.Reset();
+        Records = MoveTemp(PendingAppend);
+        PendingAppend.Reset();
+    }
+
+    if (Snapshot.IsSet() && !ReplaceOnDisk(FilePath, Snapshot.GetValue()))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Failed to write queue journal: %s"), *FilePath);
+    }
+
+    if (!Records.IsEmpty() && !AppendToDisk(FilePath, Records))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Failed to append to queue journal: %s"), *FilePath);
+    }
+}
+
+bool FSeqQueueWriter::AppendToDisk(const FString& InFilePath, const FString& Records)
+{
+    return FFileHelper::SaveStringToFile(Records, *InFilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM,
+        &IFileManager::Get(), FILEWRITE_Append);
+}
+
+bool FSeqQueueWriter::ReplaceOnDisk(const FString& InFilePath, const FString& Snapshot)
+{
+    // Write next to the journal and swap, so a crash mid-write never leaves a truncated queue
+    const FString TempPath = InFilePath + TEXT(".tmp");
+    IFileManager::Get().MakeDirectory(*FPaths::GetPath(InFilePath), true);
+    return FFileHelper::SaveStringToFile(Snapshot, *TempPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+        && IFileManager::Get().Move(*InFilePath, *TempPath, true, true);
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include <atomic>
+
+class FRunnableThread;
+class FEvent;
+
+/**
+ * Writes the queue journal off the game thread.
+ * Appends and snapshots queue up in memory; everything that arrives within the coalesce
+ * window goes to disk in one write. A snapshot supersedes anything queued before it.
+ */
+class FSeqQueueWriter : public FRunnable
+{
+public:
+    FSeqQueueWriter(const FString& InFilePath, float InCoalesceSeconds);
+    virtual ~FSeqQueueWriter() override;
+
+    void Append(const FString& Records);
+    void Replace(const FString& Snapshot);
+    void FlushNow(); // blocks until everything queued so far is on disk
+
+    static bool AppendToDisk(const FString& FilePath, const FString& Records);
+    static bool ReplaceOnDisk(const FString& FilePath, const FString& Snapshot);
+
+    // FRunnable
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+
+private:
+    void WritePending();
+
+    FString FilePath;
+    float CoalesceSeconds = 0.f;
+
+    FCriticalSection PendingLock; // guards PendingSnapshot, PendingAppend
+    FCriticalSection WriteLock;   // keeps worker and FlushNow writes in order
+    TOptional<FString> PendingSnapshot;
+    FString PendingAppend;
+
+    FEvent* WakeEvent = nullptr;
+    FRunnableThread* Thread = nullptr;
+    std::atomic<bool> bStopping { false };
+};
@@ -18,7 +18,14 @@
 #include "Animation/AnimSequence.h"
 #include "Editor.h"
 #include "SeqQueue.h"
+#include "AnimPreloader.h"
+#include "CheckpointExistenceCache.h"
+#include "VideoFolderIndex.h"
+#include "VideoProxyCache.h"
+#include "VideoProxyPrefetcher.h"
+#include "VideoProxyQueue.h"
 #include "SEditingSessionWindow.h"
+#include "EditingSessionSequencerHelper.h"
 #include "Interfaces/IPluginManager.h"
 #include "Styling/SlateStyleRegistry.h"
 #include "ToucanMidiRigBinder.h"
@@ -56,6 +63,10 @@ public:
         UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateRaw(
             this, &FToucanSequencerEditorModule::RegisterMenus));
 
+        // Trim the proxy cache to its budget, then start encoding proxies for the upcoming clips
+        FVideoProxyCache::Get().Initialize();
+        FVideoProxyPrefetcher::Get().Start();
+
         if (FModuleManager::Get().IsModuleLoaded("MidiMapper"))
         {
             USequencerControlSubsystem::RegisterSequencerMidiFunctions();
@@ -83,6 +94,15 @@ public:
         UToolMenus::UnRegisterStartupCallback(this);
         UToolMenus::UnregisterOwner(this);
         FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(ToucanEditingTabName);
+
+        // Make sure queued journal writes land before the editor goes away
+        FSeqQueue::Get().ShutdownPersistence();
+        FCheckpointExistenceCache::Get().Shutdown();
+        FVideoFolderIndex::Get().Shutdown();
+        FVideoProxyPrefetcher::Get().Shutdown();
+        FVideoProxyQueue::Get().Shutdown();
+        FAnimPreloader::Get().Shutdown();
+        FEditingSessionSequencerHelper::Shutdown();
     }
 
 private:
@@ -152,6 +172,11 @@ private:
                 return false;      // block close
             }));
 
+        DockTab->SetOnTabClosed(SDockTab::FOnTabClosedCallback::CreateLambda([](TSharedRef<SDockTab>)
+            {
+                FSeqQueue::Get().FlushNow();
+            }));
+
         return DockTab;
     }
 
@@ -227,12 +252,7 @@ private:
         TArray<FAssetData> Out;
         ARM.Get().GetAssets(Filter, Out);
 
-        int32 Added = 0;
-        for (const FAssetData& A : Out)
-        {
-            FSeqQueue::Get().Add(A);
-            ++Added;
-        }
+        const int32 Added = FSeqQueue::Get().AddBatch(Out);
 
         UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Enqueued %d assets from %s"), Added, *ContentPath);
     }
@@ -250,11 +270,8 @@ private:
             C,
             FOnAssetsChosenForOpen::CreateLambda([](const TArray<FAssetData>& SelectedAssets)
                 {
-                    for (const FAssetData& A : SelectedAssets)
-                    {
-                        FSeqQueue::Get().Add(A);
-                    }
-                    UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Enqueued %d assets"), SelectedAssets.Num());
+                    const int32 Added = FSeqQueue::Get().AddBatch(SelectedAssets);
+                    UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Enqueued %d assets"), Added);
                 }),
             FOnAssetDialogCancelled::CreateLambda([]()
                 {
@@ -0,0 +1,484 @@
+#include "VideoFolderIndex.h"
+#include "VideoNameMatcher.h"
+#include "Async/Async.h"
+#include "Algo/BinarySearch.h"
+#include "DirectoryWatcherModule.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+
+namespace
+{
+    constexpr const TCHAR* IndexHeader = TEXT("TOUCANV\t2");
+
+    FString GetIndexPath()
+    {
+        return FPaths::ProjectSavedDir() / TEXT("ToucanSessionSequencer/VideoIndex.tsv");
+    }
+
+    FString NormalizeFilePath(const FString& InPath)
+    {
+        FString Out = FPaths::ConvertRelativePathToFull(InPath);
+        FPaths::NormalizeFilename(Out);
+        return Out;
+    }
+
+    FVideoIndexEntry MakeEntry(const FString& FilePath, const FFileStatData& Stat)
+    {
+        FVideoIndexEntry Entry;
+        Entry.FilePath = FilePath;
+        Entry.NormalizedName = FVideoFolderIndex::NormalizeName(FPaths::GetBaseFilename(FilePath));
+        Entry.Size = Stat.FileSize;
+        Entry.ModifiedTime = Stat.ModificationTime;
+        return Entry;
+    }
+
+    // Directory paths as DirectoryTimes keys: the root may have been picked with a trailing slash
+    FString MakeDirectoryKey(const FString& Directory)
+    {
+        FString Key = Directory;
+        while (Key.Len() > 1 && Key.EndsWith(TEXT("/")))
+        {
+            Key.LeftChopInline(1);
+        }
+        return Key;
+    }
+
+    void SortEntries(TArray<FVideoIndexEntry>& Entries)
+    {
+        // Stable path order keeps tie-breaking in the matcher the same across scans and watcher updates
+        Entries.Sort([](const FVideoIndexEntry& A, const FVideoIndexEntry& B) { return A.FilePath < B.FilePath; });
+    }
+}
+
+bool FVideoIndexSnapshot::ContainsFile(const FString& FilePath) const
+{
+    const int32 Index = Algo::LowerBoundBy(Entries, FilePath, &FVideoIndexEntry::FilePath);
+    return Entries.IsValidIndex(Index) && Entries[Index].FilePath == FilePath;
+}
+
+FString FVideoFolderIndex::NormalizeName(const FString& InString)
+{
+    FString Out;
+    Out.Reserve(InString.Len());
+    for (TCHAR Char : InString)
+    {
+        if (FChar::IsAlnum(Char))
+        {
+            Out.AppendChar(FChar::ToLower(Char));
+        }
+    }
+    return Out;
+}
+
+bool FVideoFolderIndex::IsVideoFile(const FString& FilePath)
+{
+    const FString Extension = FPaths::GetExtension(FilePath).ToLower();
+    return Extension == TEXT("mp4") || Extension == TEXT("mov") || Extension == TEXT("mxf") || Extension == TEXT("avi");
+}
+
+void FVideoFolderIndex::SetRootFolder(const FString& Folder)
+{
+    const FString NewRoot = Folder.IsEmpty() ? FString() : NormalizeFilePath(Folder);
+    if (NewRoot == RootFolder && (GetSnapshot().IsValid() || IsScanning()))
+    {
+        return;
+    }
+
+    RootFolder = NewRoot;
+    const uint32 NewSerial = ++RootSerial;
+    {
+        FScopeLock Lock(&SnapshotLock);
+        Current.Reset();
+        PendingChanges.Reset();
+    }
+
+    StopWatching();
+    if (RootFolder.IsEmpty())
+    {
+        IndexUpdated.Broadcast();
+        return;
+    }
+
+    StartScan(RootFolder, NewSerial, true);
+    WatchFolder(RootFolder);
+}
+
+void FVideoFolderIndex::RequestRescan()
+{
+    if (!RootFolder.IsEmpty())
+    {
+        StartScan(RootFolder, RootSerial.load(), false);
+    }
+}
+
+void FVideoFolderIndex::Shutdown()
+{
+    ++RootSerial; // in-flight scans notice and bail out
+    StopWatching();
+    for (TFuture<void>& Task : Tasks)
+    {
+        Task.Wait();
+    }
+    Tasks.Reset();
+}
+
+TSharedPtr<const FVideoIndexSnapshot> FVideoFolderIndex::GetSnapshot() const
+{
+    FScopeLock Lock(&SnapshotLock);
+    return Current;
+}
+
+void FVideoFolderIndex::StartScan(const FString& Folder, uint32 ScanSerial, bool bLoadCacheFirst)
+{
+    PruneFinishedTasks();
+    ++ActiveScans;
+    Tasks.Add(Async(EAsyncExecution::Thread, [this, Folder, ScanSerial, bLoadCacheFirst]()
+    {
+        // Last session's index gets lookups going, and is the base the share is reconciled against
+        TSharedPtr<const FVideoIndexSnapshot> Base;
+        if (bLoadCacheFirst)
+        {
+            if (TSharedPtr<FVideoIndexSnapshot> Cached = LoadFromDisk(Folder))
+            {
+                Publish(Cached, ScanSerial);
+                Base = Cached;
+            }
+        }
+        else
+        {
+            Base = GetSnapshot();
+        }
+        if (Base.IsValid() && Base->RootFolder != Folder)
+        {
+            Base.Reset();
+        }
+
+        const double StartSeconds = FPlatformTime::Seconds();
+        if (TSharedPtr<FVideoIndexSnapshot> Scanned = ScanFolder(Folder, ScanSerial, Base.Get()))
+        {
+            UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Indexed %d videos in %s (%.1fs)"),
+                Scanned->Entries.Num(), *Folder, FPlatformTime::Seconds() - StartSeconds);
+            Publish(Scanned, ScanSerial);
+            SaveToDisk(*Scanned);
+        }
+        --ActiveScans;
+    }));
+}
+
+void FVideoFolderIndex::Publish(TSharedPtr<FVideoIndexSnapshot> Snapshot, uint32 ScanSerial)
+{
+    // Still on the worker: readers only ever see a snapshot with its matcher in place
+    Snapshot->Matcher = MakeShared<FVideoNameMatcher>(Snapshot->Entries);
+    {
+        FScopeLock Lock(&SnapshotLock);
+        if (ScanSerial != RootSerial.load())
+        {
+            return;
+        }
+        Current = MoveTemp(Snapshot);
+    }
+
+    AsyncTask(ENamedThreads::GameThread, [this, ScanSerial]()
+    {
+        if (ScanSerial == RootSerial.load())
+        {
+            IndexUpdated.Broadcast();
+        }
+    });
+}
+
+void FVideoFolderIndex::PruneFinishedTasks()
+{
+    Tasks.RemoveAll([](const TFuture<void>& Task) { return Task.IsReady(); });
+}
+
+TSharedPtr<FVideoIndexSnapshot> FVideoFolderIndex::ScanFolder(const FString& Folder, uint32 ScanSerial, const FVideoIndexSnapshot* Base) const
+{
+    TSharedPtr<FVideoIndexSnapshot> Snapshot = MakeShared<FVideoIndexSnapshot>();
+    Snapshot->RootFolder = Folder;
+
+    // What the base knew, grouped by parent directory
+    TMap<FString, TArray<int32>> BaseFilesByDirectory;
+    TMap<FString, TArray<FString>> BaseSubdirectoriesByDirectory;
+    if (Base)
+    {
+        for (int32 Index = 0; Index < Base->Entries.Num(); ++Index)
+        {
+            BaseFilesByDirectory.FindOrAdd(MakeDirectoryKey(FPaths::GetPath(Base->Entries[Index].FilePath))).Add(Index);
+        }
+        for (const TPair<FString, FDateTime>& Directory : Base->DirectoryTimes)
+        {
+            if (Directory.Key != MakeDirectoryKey(Folder))
+            {
+                BaseSubdirectoriesByDirectory.FindOrAdd(MakeDirectoryKey(FPaths::GetPath(Directory.Key))).Add(Directory.Key);
+            }
+        }
+    }
+
+    // One stat per directory; only directories whose modification time moved are listed again.
+    // Adding, removing or renaming an entry updates its directory's time, which is all matching cares about.
+    int32 NumListed = 0;
+    int32 NumReused = 0;
+    TArray<FString> Pending;
+    Pending.Add(Folder);
+    while (Pending.Num() > 0)
+    {
+        if (ScanSerial != RootSerial.load())
+        {
+            return nullptr;
+        }
+
+        const FString Directory = Pending.Pop();
+        const FFileStatData DirectoryStat = IFileManager::Get().GetStatData(*Directory);
+        if (!DirectoryStat.bIsValid || !DirectoryStat.bIsDirectory)
+        {
+            continue;
+        }
+
+        const FString Key = MakeDirectoryKey(Directory);
+        Snapshot->DirectoryTimes.Add(Key, DirectoryStat.ModificationTime);
+
+        const FDateTime* KnownTime = Base ? Base->DirectoryTimes.Find(Key) : nullptr;
+        if (KnownTime && *KnownTime == DirectoryStat.ModificationTime)
+        {
+            if (const TArray<int32>* Files = BaseFilesByDirectory.Find(Key))
+            {
+                for (const int32 Index : *Files)
+                {
+                    Snapshot->Entries.Add(Base->Entries[Index]);
+                }
+            }
+            if (const TArray<FString>* Subdirectories = BaseSubdirectoriesByDirectory.Find(Key))
+            {
+                Pending.Append(*Subdirectories);
+            }
+            ++NumReused;
+            continue;
+        }
+
+        ++NumListed;
+        IFileManager::Get().IterateDirectoryStat(*Directory, [&Snapshot, &Pending](const TCHAR* FilenameOrDirectory, const FFileStatData& Stat)
+        {
+            if (Stat.bIsDirectory)
+            {
+                Pending.Add(NormalizeFilePath(FilenameOrDirectory));
+            }
+            else if (IsVideoFile(FilenameOrDirectory))
+            {
+                Snapshot->Entries.Add(MakeEntry(NormalizeFilePath(FilenameOrDirectory), Stat));
+            }
+            return true;
+        });
+    }
+
+    UE_LOG(LogTemp, Verbose, TEXT("[ToucanSequencer] Video index pass over %s: %d directories listed, %d unchanged."), *Folder, NumListed, NumReused);
+    SortEntries(Snapshot->Entries);
+    return Snapshot;
+}
+
+void FVideoFolderIndex::WatchFolder(const FString& Folder)
+{
+    FDirectoryWatcherModule& DirectoryWatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+    IDirectoryWatcher* Watcher = DirectoryWatcherModule.Get();
+    if (!Watcher)
+    {
+        return;
+    }
+
+    if (Watcher->RegisterDirectoryChangedCallback_Handle(
+        Folder,
+        IDirectoryWatcher::FDirectoryChanged::CreateRaw(this, &FVideoFolderIndex::OnDirectoryChanged),
+        WatcherHandle,
+        IDirectoryWatcher::WatchOptions::IncludeDirectoryChanges))
+    {
+        WatchedFolder = Folder;
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Cannot watch %s; the video index only refreshes on rescan."), *Folder);
+    }
+}
+
+void FVideoFolderIndex::StopWatching()
+{
+    if (WatchedFolder.IsEmpty())
+    {
+        return;
+    }
+
+    if (FDirectoryWatcherModule* DirectoryWatcherModule = FModuleManager::GetModulePtr<FDirectoryWatcherModule>(TEXT("DirectoryWatcher")))
+    {
+        if (IDirectoryWatcher* Watcher = DirectoryWatcherModule->Get())
+        {
+            Watcher->UnregisterDirectoryChangedCallback_Handle(WatchedFolder, WatcherHandle);
+        }
+    }
+
+    WatchedFolder.Reset();
+    WatcherHandle.Reset();
+}
+
+void FVideoFolderIndex::OnDirectoryChanged(const TArray<FFileChangeData>& Changes)
+{
+    bool bNeedsRescan = false;
+    bool bSchedule = false;
+    {
+        FScopeLock Lock(&SnapshotLock);
+        for (const FFileChangeData& Change : Changes)
+        {
+            if (IsVideoFile(Change.Filename))
+            {
+                PendingChanges.Add(Change);
+            }
+            else if (Change.Action == FFileChangeData::FCA_RescanRequired || FPaths::GetExtension(Change.Filename).IsEmpty())
+            {
+                // A whole directory came or went; cheaper to walk again than to guess what was in it
+                bNeedsRescan = true;
+            }
+        }
+
+        if (!bNeedsRescan && PendingChanges.Num() > 0 && !bApplyScheduled)
+        {
+            bApplyScheduled = true;
+            bSchedule = true;
+        }
+    }
+
+    if (bNeedsRescan)
+    {
+        {
+            FScopeLock Lock(&SnapshotLock);
+            PendingChanges.Reset();
+        }
+        RequestRescan();
+        return;
+    }
+
+    if (bSchedule)
+    {
+        PruneFinishedTasks();
+        const uint32 ScanSerial = RootSerial.load();
+        Tasks.Add(Async(EAsyncExecution::ThreadPool, [this, ScanSerial]() { ApplyPendingChanges(ScanSerial); }));
+    }
+}
+
+void FVideoFolderIndex::ApplyPendingChanges(uint32 ScanSerial)
+{
+    TArray<FFileChangeData> Changes;
+    TSharedPtr<const FVideoIndexSnapshot> Base;
+    {
+        FScopeLock Lock(&SnapshotLock);
+        Changes = MoveTemp(PendingChanges);
+        PendingChanges.Reset();
+        bApplyScheduled = false;
+        Base = Current;
+    }
+
+    // Without a base a scan is still running, and it will pick these files up itself
+    if (!Base.IsValid() || Changes.IsEmpty())
+    {
+        return;
+    }
+
+    TSharedPtr<FVideoIndexSnapshot> Next = MakeShared<FVideoIndexSnapshot>(*Base);
+    for (const FFileChangeData& Change : Changes)
+    {
+        const FString FilePath = NormalizeFilePath(Change.Filename);
+        const int32 Existing = Algo::LowerBoundBy(Next->Entries, FilePath, &FVideoIndexEntry::FilePath);
+        const bool bFound = Next->Entries.IsValidIndex(Existing) && Next->Entries[Existing].FilePath == FilePath;
+
+        const FFileStatData Stat = Change.Action == FFileChangeData::FCA_Removed
+            ? FFileStatData()
+            : IFileManager::Get().GetStatData(*FilePath);
+
+        if (Stat.bIsValid && !Stat.bIsDirectory)
+        {
+            FVideoIndexEntry Entry = MakeEntry(FilePath, Stat);
+            if (bFound)
+            {
+                Next->Entries[Existing] = MoveTemp(Entry);
+            }
+            else
+            {
+                Next->Entries.Insert(MoveTemp(Entry), Existing);
+            }
+        }
+        else if (bFound)
+        {
+            Next->Entries.RemoveAt(Existing);
+        }
+    }
+
+    Publish(Next, ScanSerial);
+    SaveToDisk(*Next);
+}
+
+TSharedPtr<FVideoIndexSnapshot> FVideoFolderIndex::LoadFromDisk(const FString& Folder)
+{
+    TArray<FString> Lines;
+    if (!FFileHelper::LoadFileToStringArray(Lines, *GetIndexPath()) || Lines.Num() < 2)
+    {
+        return nullptr;
+    }
+
+    // Header is followed by the root folder the index was built for; a different folder means start over
+    if (Lines[0] != IndexHeader || Lines[1] != Folder)
+    {
+        return nullptr;
+    }
+
+    TSharedPtr<FVideoIndexSnapshot> Snapshot = MakeShared<FVideoIndexSnapshot>();
+    Snapshot->RootFolder = Folder;
+    Snapshot->Entries.Reserve(Lines.Num() - 2);
+
+    TArray<FString> Fields;
+    for (int32 LineIndex = 2; LineIndex < Lines.Num(); ++LineIndex)
+    {
+        Lines[LineIndex].ParseIntoArray(Fields, TEXT("\t"), false);
+        if (Fields.Num() == 3 && Fields[0] == TEXT("D"))
+        {
+            Snapshot->DirectoryTimes.Add(MoveTemp(Fields[2]), FDateTime(FCString::Atoi64(*Fields[1])));
+            continue;
+        }
+        if (Fields.Num() != 4)
+        {
+            continue;
+        }
+
+        FVideoIndexEntry Entry;
+        Entry.Size = FCString::Atoi64(*Fields[0]);
+        Entry.ModifiedTime = FDateTime(FCString::Atoi64(*Fields[1]));
+        Entry.NormalizedName = MoveTemp(Fields[2]);
+        Entry.FilePath = MoveTemp(Fields[3]);
+        Snapshot->Entries.Add(MoveTemp(Entry));
+    }
+
+    SortEntries(Snapshot->Entries);
+    return Snapshot;
+}
+
+void FVideoFolderIndex::SaveToDisk(const FVideoIndexSnapshot& Snapshot)
+{
+    static FCriticalSection SaveLock;
+    FScopeLock Lock(&SaveLock);
+
+    TStringBuilder<4096> Text;
+    Text << IndexHeader << TEXT("\n") << Snapshot.RootFolder << TEXT("\n");
+    for (const TPair<FString, FDateTime>& Directory : Snapshot.DirectoryTimes)
+    {
+        Text << TEXT("D\t") << Directory.Value.GetTicks() << TEXT("\t") << Directory.Key << TEXT("\n");
+    }
+    for (const FVideoIndexEntry& Entry : Snapshot.Entries)
+    {
+        Text << Entry.Size << TEXT("\t") << Entry.ModifiedTime.GetTicks() << TEXT("\t") << Entry.NormalizedName << TEXT("\t") << Entry.FilePath << TEXT("\n");
+    }
+
+    const FString TempPath = GetIndexPath() + TEXT(".tmp");
+    if (!FFileHelper::SaveStringToFile(Text.ToView(), *TempPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+        || !IFileManager::Get().Move(*GetIndexPath(), *TempPath, true, true))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Failed to write video index: %s"), *GetIndexPath());
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "IDirectoryWatcher.h"
+#include <atomic>
+
+class FVideoNameMatcher;
+
+/** One candidate video file in the selected video folder */
+struct FVideoIndexEntry
+{
+    FString FilePath;
+    FString NormalizedName; // lowercase alphanumerics of the base filename, see FVideoFolderIndex::NormalizeName
+    int64 Size = 0;
+    FDateTime ModifiedTime;
+};
+
+/** Immutable view of the index; readers hold on to it while a newer one is being built */
+struct FVideoIndexSnapshot
+{
+    FString RootFolder;
+    TArray<FVideoIndexEntry> Entries;
+    TMap<FString, FDateTime> DirectoryTimes; // every directory walked under RootFolder, keyed without a trailing slash
+    TSharedPtr<const FVideoNameMatcher> Matcher; // built over Entries when the snapshot is published
+
+    bool ContainsFile(const FString& FilePath) const; // binary search, Entries are kept in path order
+};
+
+/**
+ * Index of the video files under the selected video folder.
+ * The last known state is kept in Saved/ToucanSessionSequencer/VideoIndex.tsv and shown straight away;
+ * a background pass then reconciles it with disk, listing only directories whose modification time changed,
+ * and a directory watcher keeps it current afterwards.
+ * Lookups only read the current snapshot and never touch the filesystem.
+ */
+class FVideoFolderIndex
+{
+public:
+    static FVideoFolderIndex& Get()
+    {
+        static FVideoFolderIndex S;
+        return S;
+    }
+
+    DECLARE_MULTICAST_DELEGATE(FOnIndexUpdated);
+    FOnIndexUpdated& OnIndexUpdated() { return IndexUpdated; } // game thread, after a new snapshot is published
+
+    void SetRootFolder(const FString& Folder); // no-op if unchanged
+    void RequestRescan(); // background reconcile against the current snapshot; a full walk if there is none
+    void Shutdown(); // waits for background work and stops watching
+
+    TSharedPtr<const FVideoIndexSnapshot> GetSnapshot() const; // null until something has been loaded or scanned
+    bool IsScanning() const { return ActiveScans.load() > 0; }
+
+    static FString NormalizeName(const FString& InString);
+    static bool IsVideoFile(const FString& FilePath);
+
+private:
+    FVideoFolderIndex() = default;
+
+    void StartScan(const FString& Folder, uint32 ScanSerial, bool bLoadCacheFirst);
+    void Publish(TSharedPtr<FVideoIndexSnapshot> Snapshot, uint32 ScanSerial);
+    void WatchFolder(const FString& Folder);
+    void StopWatching();
+    void OnDirectoryChanged(const TArray<FFileChangeData>& Changes);
+    void ApplyPendingChanges(uint32 ScanSerial);
+    void PruneFinishedTasks();
+
+    TSharedPtr<FVideoIndexSnapshot> ScanFolder(const FString& Folder, uint32 ScanSerial, const FVideoIndexSnapshot* Base) const; // null if cancelled
+    static TSharedPtr<FVideoIndexSnapshot> LoadFromDisk(const FString& Folder);
+    static void SaveToDisk(const FVideoIndexSnapshot& Snapshot);
+
+    mutable FCriticalSection SnapshotLock; // guards Current and PendingChanges
+    TSharedPtr<const FVideoIndexSnapshot> Current;
+    TArray<FFileChangeData> PendingChanges;
+    bool bApplyScheduled = false;
+
+    FString RootFolder;
+    std::atomic<uint32> RootSerial { 0 }; // bumped on every root change so stale results are dropped
+    std::atomic<int32> ActiveScans { 0 };
+    TArray<TFuture<void>> Tasks;
+
+    FString WatchedFolder;
+    FDelegateHandle WatcherHandle;
+    FOnIndexUpdated IndexUpdated;
+};
@@ -0,0 +1,103 @@
+#include "VideoMatchAllJob.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "SeqQueue.h"
+#include "VideoFolderIndex.h"
+#include "VideoNameMatcher.h"
+
+namespace
+{
+    bool bRunning = false; // game thread only
+
+    struct FMatchRequest
+    {
+        FSoftObjectPath Path;
+        FString NormalizedName;
+        FString MatchedVideoPath;
+        int32 Score = 0;
+    };
+}
+
+bool FVideoMatchAllJob::IsRunning()
+{
+    return bRunning;
+}
+
+bool FVideoMatchAllJob::Start()
+{
+    check(IsInGameThread());
+    if (bRunning)
+    {
+        return false;
+    }
+
+    TSharedPtr<const FVideoIndexSnapshot> VideoIndex = FVideoFolderIndex::Get().GetSnapshot();
+    if (!VideoIndex.IsValid())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Video index is not ready yet; cannot match the queue."));
+        return false;
+    }
+
+    // Workers only see this copy; the queue itself is touched on the game thread again once they are done
+    TSharedRef<TArray<FMatchRequest>> Requests = MakeShared<TArray<FMatchRequest>>();
+    const TArray<FQueuedAnim>& All = FSeqQueue::Get().GetAll();
+    Requests->Reserve(All.Num());
+    for (const FQueuedAnim& Q : All)
+    {
+        FMatchRequest& Request = Requests->AddDefaulted_GetRef();
+        Request.Path = Q.Path;
+        Request.NormalizedName = FVideoFolderIndex::NormalizeName(Q.DisplayName.IsEmpty() ? Q.Path.GetAssetName() : Q.DisplayName.ToString());
+    }
+
+    if (Requests->IsEmpty())
+    {
+        return false;
+    }
+
+    bRunning = true;
+    Async(EAsyncExecution::ThreadPool, [VideoIndex, Requests]()
+    {
+        const double StartSeconds = FPlatformTime::Seconds();
+        ParallelFor(Requests->Num(), [&VideoIndex, &Requests](int32 RequestIndex)
+        {
+            FMatchRequest& Request = (*Requests)[RequestIndex];
+            const FVideoNameMatcher::FMatch Match = VideoIndex->Matcher->FindBest(Request.NormalizedName, FVideoNameMatcher::DefaultMinimumScore);
+            if (Match.EntryIndex != INDEX_NONE)
+            {
+                Request.MatchedVideoPath = VideoIndex->Entries[Match.EntryIndex].FilePath;
+                Request.Score = Match.Score;
+            }
+        });
+        const double ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+        AsyncTask(ENamedThreads::GameThread, [VideoIndex, Requests, ElapsedSeconds]()
+        {
+            bRunning = false;
+
+            // A newer snapshot of the same folder is fine; a different folder makes these results meaningless
+            const TSharedPtr<const FVideoIndexSnapshot> CurrentIndex = FVideoFolderIndex::Get().GetSnapshot();
+            if (!CurrentIndex.IsValid() || CurrentIndex->RootFolder != VideoIndex->RootFolder)
+            {
+                UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Video folder changed during matching; results discarded."));
+                return;
+            }
+
+            int32 WeakCount = 0;
+            {
+                FSeqQueue::FScopedBatch Batch;
+                for (const FMatchRequest& Request : *Requests)
+                {
+                    WeakCount += Request.MatchedVideoPath.IsEmpty() ? 1 : 0;
+                    FSeqQueue::Get().SetVideoMatch(Request.Path, Request.MatchedVideoPath, Request.Score);
+                }
+            }
+
+            UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Matched %d queue items against %d videos in %.2fs; %d without a confident match."),
+                Requests->Num(),
+                VideoIndex->Entries.Num(),
+                ElapsedSeconds,
+                WeakCount);
+        });
+    });
+    return true;
+}
@@ -0,0 +1,13 @@
+#pragma once
+#include "CoreMinimal.h"
+
+/**
+ * Scores every queued animation against the current video index on worker threads and stores the
+ * best match on the queue item, so loading a clip only reads the stored result.
+ */
+class FVideoMatchAllJob
+{
+public:
+    static bool Start(); // false if the index is not ready yet or a run is already going
+    static bool IsRunning();
+};
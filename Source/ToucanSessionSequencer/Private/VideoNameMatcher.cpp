@@ -0,0 +1,614 @@
+#include "VideoNameMatcher.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "VideoFolderIndex.h"
+
+namespace
+{
+    // Trigram hits only choose where the exact sweep starts; a few good names are enough
+    constexpr int32 MaxTrigramCandidates = 32;
+    constexpr int32 ContainmentScoreBase = 1000;
+
+    // Reference two-row DP; every cell past column 0 is written before it is read, so one buffer serves all calls
+    int32 ScalarLcsLength(const FString& A, const FString& B, TArray<int32>& Scratch)
+    {
+        const int32 Width = B.Len() + 1;
+        if (Scratch.Num() < Width * 2)
+        {
+            Scratch.SetNumUninitialized(Width * 2);
+        }
+        int32* Previous = Scratch.GetData();
+        int32* Current = Previous + Width;
+        FMemory::Memzero(Previous, Width * sizeof(int32));
+        Current[0] = 0;
+
+        for (int32 AIndex = 1; AIndex <= A.Len(); ++AIndex)
+        {
+            const TCHAR AChar = A[AIndex - 1];
+            for (int32 BIndex = 1; BIndex <= B.Len(); ++BIndex)
+            {
+                if (AChar == B[BIndex - 1])
+                {
+                    Current[BIndex] = Previous[BIndex - 1] + 1;
+                }
+                else
+                {
+                    Current[BIndex] = FMath::Max(Previous[BIndex], Current[BIndex - 1]);
+                }
+            }
+            Swap(Previous, Current);
+        }
+
+        return Previous[B.Len()];
+    }
+
+    /** Per-character bit masks of a pattern of up to 64 characters, one bit per position */
+    struct FLcsPattern
+    {
+        static constexpr int32 MaxLen = 64;
+
+        uint64 AsciiMasks[128];
+        TArray<TPair<TCHAR, uint64>, TInlineAllocator<8>> OtherMasks;
+        int32 Len = 0;
+
+        bool Init(const FString& Pattern)
+        {
+            if (Pattern.Len() > MaxLen)
+            {
+                return false;
+            }
+
+            FMemory::Memzero(AsciiMasks, sizeof(AsciiMasks));
+            OtherMasks.Reset();
+            Len = Pattern.Len();
+            for (int32 Index = 0; Index < Len; ++Index)
+            {
+                const TCHAR Char = Pattern[Index];
+                if (static_cast<uint32>(Char) < 128)
+                {
+                    AsciiMasks[Char] |= 1ull << Index;
+                    continue;
+                }
+
+                TPair<TCHAR, uint64>* Existing = OtherMasks.FindByPredicate([Char](const TPair<TCHAR, uint64>& Pair) { return Pair.Key == Char; });
+                if (Existing)
+                {
+                    Existing->Value |= 1ull << Index;
+                }
+                else
+                {
+                    OtherMasks.Emplace(Char, 1ull << Index);
+                }
+            }
+            return true;
+        }
+
+        uint64 GetMask(TCHAR Char) const
+        {
+            if (static_cast<uint32>(Char) < 128)
+            {
+                return AsciiMasks[Char];
+            }
+            for (const TPair<TCHAR, uint64>& Pair : OtherMasks)
+            {
+                if (Pair.Key == Char)
+                {
+                    return Pair.Value;
+                }
+            }
+            return 0;
+        }
+    };
+
+    // Allison-Dix / Hyyro bit-vector LCS: zero bits of V mark pattern positions matched so far
+    int32 BitParallelLcsLength(const FLcsPattern& Pattern, const FString& Text)
+    {
+        uint64 V = ~0ull;
+        for (TCHAR Char : Text)
+        {
+            const uint64 U = V & Pattern.GetMask(Char);
+            V = (V + U) | (V - U);
+        }
+
+        const uint64 PatternBits = Pattern.Len == FLcsPattern::MaxLen ? ~0ull : ((1ull << Pattern.Len) - 1);
+        return FMath::CountBits(~V & PatternBits);
+    }
+
+    // Four texts against one pattern in lock step. The lanes are independent, so the adds and subtracts overlap
+    // and the compiler can put them in vector registers; padding lanes should be empty strings
+    void BitParallelLcsLengthX4(const FLcsPattern& Pattern, const FString* const Texts[4], int32 OutLengths[4])
+    {
+        uint64 V[4] = { ~0ull, ~0ull, ~0ull, ~0ull };
+        const int32 CommonLen = FMath::Min(FMath::Min(Texts[0]->Len(), Texts[1]->Len()), FMath::Min(Texts[2]->Len(), Texts[3]->Len()));
+        for (int32 CharIndex = 0; CharIndex < CommonLen; ++CharIndex)
+        {
+            for (int32 Lane = 0; Lane < 4; ++Lane)
+            {
+                const uint64 U = V[Lane] & Pattern.GetMask((*Texts[Lane])[CharIndex]);
+                V[Lane] = (V[Lane] + U) | (V[Lane] - U);
+            }
+        }
+
+        const uint64 PatternBits = Pattern.Len == FLcsPattern::MaxLen ? ~0ull : ((1ull << Pattern.Len) - 1);
+        for (int32 Lane = 0; Lane < 4; ++Lane)
+        {
+            const FString& Text = *Texts[Lane];
+            for (int32 CharIndex = CommonLen; CharIndex < Text.Len(); ++CharIndex)
+            {
+                const uint64 U = V[Lane] & Pattern.GetMask(Text[CharIndex]);
+                V[Lane] = (V[Lane] + U) | (V[Lane] - U);
+            }
+            OutLengths[Lane] = FMath::CountBits(~V[Lane] & PatternBits);
+        }
+    }
+
+    // APattern is A's masks when the caller has them already; LCS is symmetric, so either side can be the pattern
+    int32 LongestCommonSubsequenceLength(const FString& A, const FString& B, const FLcsPattern* APattern, TArray<int32>& Scratch)
+    {
+        if (A.IsEmpty() || B.IsEmpty())
+        {
+            return 0;
+        }
+
+        int32 Length = 0;
+        if (APattern)
+        {
+            Length = BitParallelLcsLength(*APattern, B);
+        }
+        else if (FMath::Min(A.Len(), B.Len()) <= FLcsPattern::MaxLen)
+        {
+            const bool bAIsPattern = A.Len() <= B.Len();
+            FLcsPattern Pattern;
+            Pattern.Init(bAIsPattern ? A : B);
+            Length = BitParallelLcsLength(Pattern, bAIsPattern ? B : A);
+        }
+        else
+        {
+            return ScalarLcsLength(A, B, Scratch);
+        }
+
+        checkSlow(Length == ScalarLcsLength(A, B, Scratch));
+        return Length;
+    }
+
+    int32 PercentOfLonger(int32 Length, int32 QueueNameLen, int32 VideoNameLen)
+    {
+        const int32 Denominator = FMath::Max(QueueNameLen, VideoNameLen);
+        return Denominator > 0 ? FMath::RoundToInt(100.0f * static_cast<float>(Length) / static_cast<float>(Denominator)) : 0;
+    }
+
+    int32 ScoreNames(const FString& NormalizedQueueName, const FString& NormalizedVideoName, const FLcsPattern* QueuePattern, TArray<int32>& Scratch)
+    {
+        if (NormalizedQueueName.IsEmpty() || NormalizedVideoName.IsEmpty())
+        {
+            return 0;
+        }
+
+        if (NormalizedVideoName.Contains(NormalizedQueueName) || NormalizedQueueName.Contains(NormalizedVideoName))
+        {
+            return ContainmentScoreBase + FMath::Min(NormalizedQueueName.Len(), NormalizedVideoName.Len());
+        }
+
+        const int32 LcsLength = LongestCommonSubsequenceLength(NormalizedQueueName, NormalizedVideoName, QueuePattern, Scratch);
+        return PercentOfLonger(LcsLength, NormalizedQueueName.Len(), NormalizedVideoName.Len());
+    }
+
+    // ScoreNames for every candidate, with the LCS of non-contained names run four at a time against the query's masks
+    void ScoreNamesBatch(const FString& NormalizedQueueName, const TArray<FString>& Names, TConstArrayView<int32> Candidates,
+        const FLcsPattern& QueuePattern, TArray<int32>& OutScores)
+    {
+        OutScores.SetNumUninitialized(Candidates.Num());
+
+        const FString EmptyLane;
+        const FString* LaneTexts[4] = { &EmptyLane, &EmptyLane, &EmptyLane, &EmptyLane };
+        int32 LaneSlots[4];
+        int32 NumLanes = 0;
+
+        auto FlushLanes = [&]()
+        {
+            int32 LaneLengths[4];
+            BitParallelLcsLengthX4(QueuePattern, LaneTexts, LaneLengths);
+            for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+            {
+                OutScores[LaneSlots[Lane]] = PercentOfLonger(LaneLengths[Lane], NormalizedQueueName.Len(), LaneTexts[Lane]->Len());
+                LaneTexts[Lane] = &EmptyLane;
+            }
+            NumLanes = 0;
+        };
+
+        for (int32 Slot = 0; Slot < Candidates.Num(); ++Slot)
+        {
+            const FString& VideoName = Names[Candidates[Slot]];
+            if (NormalizedQueueName.IsEmpty() || VideoName.IsEmpty())
+            {
+                OutScores[Slot] = 0;
+            }
+            else if (VideoName.Contains(NormalizedQueueName) || NormalizedQueueName.Contains(VideoName))
+            {
+                OutScores[Slot] = ContainmentScoreBase + FMath::Min(NormalizedQueueName.Len(), VideoName.Len());
+            }
+            else
+            {
+                LaneTexts[NumLanes] = &VideoName;
+                LaneSlots[NumLanes] = Slot;
+                if (++NumLanes == 4)
+                {
+                    FlushLanes();
+                }
+            }
+        }
+        if (NumLanes > 0)
+        {
+            FlushLanes();
+        }
+    }
+}
+
+FVideoNameMatcher::FVideoNameMatcher(const TArray<FVideoIndexEntry>& Entries)
+{
+    Names.Reserve(Entries.Num());
+    CharCounts.SetNumZeroed(Entries.Num() * NumCharBuckets);
+
+    for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+    {
+        const FString& Name = Names.Add_GetRef(Entries[EntryIndex].NormalizedName);
+
+        uint16* Counts = &CharCounts[EntryIndex * NumCharBuckets];
+        for (TCHAR Char : Name)
+        {
+            uint16& Count = Counts[CharBucket(Char)];
+            Count = Count < MAX_uint16 ? Count + 1 : Count;
+        }
+
+        for (int32 CharIndex = 0; CharIndex + 3 <= Name.Len(); ++CharIndex)
+        {
+            // Entries are visited in order, so a repeated trigram only ever needs checking against the tail
+            TArray<int32>& Posting = TrigramPostings.FindOrAdd(MakeTrigram(*Name + CharIndex));
+            if (Posting.IsEmpty() || Posting.Last() != EntryIndex)
+            {
+                Posting.Add(EntryIndex);
+            }
+        }
+    }
+}
+
+FVideoNameMatcher::FMatch FVideoNameMatcher::FindBest(const FString& NormalizedQueueName, int32 MinimumScore) const
+{
+    FMatch Best;
+    if (NormalizedQueueName.IsEmpty() || Names.IsEmpty())
+    {
+        return Best;
+    }
+
+    // Anything at or below zero never counted as a match
+    const int32 Threshold = FMath::Max(MinimumScore, 1);
+    TArray<int32> Scratch;
+    TBitArray<> Evaluated(false, Names.Num());
+
+    // The query is the same for every candidate, so its bit masks are built once
+    FLcsPattern QueryPatternStorage;
+    const FLcsPattern* QueryPattern = QueryPatternStorage.Init(NormalizedQueueName) ? &QueryPatternStorage : nullptr;
+
+    auto Consider = [&Best, Threshold](int32 EntryIndex, int32 Score)
+    {
+        if (Score >= Threshold &&
+            (Best.EntryIndex == INDEX_NONE || Score > Best.Score || (Score == Best.Score && EntryIndex < Best.EntryIndex)))
+        {
+            Best.EntryIndex = EntryIndex;
+            Best.Score = Score;
+        }
+    };
+
+    // 1) Names sharing the most trigrams with the query are likely winners; scoring them first raises the bar
+    if (NormalizedQueueName.Len() >= 3)
+    {
+        TArray<uint16> Hits;
+        Hits.SetNumZeroed(Names.Num());
+        TArray<int32> Touched;
+        TSet<uint64> SeenTrigrams;
+
+        for (int32 CharIndex = 0; CharIndex + 3 <= NormalizedQueueName.Len(); ++CharIndex)
+        {
+            bool bAlreadySeen = false;
+            const uint64 Trigram = MakeTrigram(*NormalizedQueueName + CharIndex);
+            SeenTrigrams.Add(Trigram, &bAlreadySeen);
+            if (bAlreadySeen)
+            {
+                continue;
+            }
+
+            if (const TArray<int32>* Posting = TrigramPostings.Find(Trigram))
+            {
+                for (const int32 EntryIndex : *Posting)
+                {
+                    if (Hits[EntryIndex]++ == 0)
+                    {
+                        Touched.Add(EntryIndex);
+                    }
+                }
+            }
+        }
+
+        Touched.Sort([&Hits](int32 A, int32 B) { return Hits[A] != Hits[B] ? Hits[A] > Hits[B] : A < B; });
+
+        // Every one of these is scored regardless of the others, so they go through the four-lane kernel together
+        const TConstArrayView<int32> Candidates(Touched.GetData(), FMath::Min(Touched.Num(), MaxTrigramCandidates));
+        TArray<int32> CandidateScores;
+        if (QueryPattern)
+        {
+            ScoreNamesBatch(NormalizedQueueName, Names, Candidates, *QueryPattern, CandidateScores);
+        }
+        else
+        {
+            for (const int32 EntryIndex : Candidates)
+            {
+                CandidateScores.Add(ScoreNames(NormalizedQueueName, Names[EntryIndex], nullptr, Scratch));
+            }
+        }
+
+        for (int32 Rank = 0; Rank < Candidates.Num(); ++Rank)
+        {
+            Evaluated[Candidates[Rank]] = true;
+            Consider(Candidates[Rank], CandidateScores[Rank]);
+        }
+    }
+
+    // 2) Exact sweep: only names whose character-count bound can still beat the best so far get the LCS
+    uint16 QueryCounts[NumCharBuckets] = {};
+    for (TCHAR Char : NormalizedQueueName)
+    {
+        uint16& Count = QueryCounts[CharBucket(Char)];
+        Count = Count < MAX_uint16 ? Count + 1 : Count;
+    }
+
+    for (int32 EntryIndex = 0; EntryIndex < Names.Num(); ++EntryIndex)
+    {
+        if (Evaluated[EntryIndex])
+        {
+            continue;
+        }
+
+        const int32 Bound = UpperBound(EntryIndex, NormalizedQueueName, QueryCounts);
+        if (Bound < Threshold)
+        {
+            continue;
+        }
+        if (Best.EntryIndex != INDEX_NONE && (Bound < Best.Score || (Bound == Best.Score && EntryIndex > Best.EntryIndex)))
+        {
+            continue;
+        }
+
+        Consider(EntryIndex, ScoreNames(NormalizedQueueName, Names[EntryIndex], QueryPattern, Scratch));
+    }
+
+    return Best;
+}
+
+int32 FVideoNameMatcher::Score(const FString& NormalizedQueueName, const FString& NormalizedVideoName)
+{
+    TArray<int32> Scratch;
+    return ScoreNames(NormalizedQueueName, NormalizedVideoName, nullptr, Scratch);
+}
+
+int32 FVideoNameMatcher::UpperBound(int32 EntryIndex, const FString& Query, const uint16* QueryCounts) const
+{
+    const FString& Name = Names[EntryIndex];
+    if (Name.IsEmpty())
+    {
+        return 0;
+    }
+
+    // Shared characters bound the LCS from above; merging non-alphanumerics into one bucket only loosens it
+    const uint16* Counts = &CharCounts[EntryIndex * NumCharBuckets];
+    int32 Overlap = 0;
+    for (int32 Bucket = 0; Bucket < NumCharBuckets; ++Bucket)
+    {
+        Overlap += FMath::Min(QueryCounts[Bucket], Counts[Bucket]);
+    }
+
+    // Containment needs every character of the shorter name present in the longer one
+    const int32 Shorter = FMath::Min(Query.Len(), Name.Len());
+    if (Overlap >= Shorter)
+    {
+        return ContainmentScoreBase + Shorter;
+    }
+    return PercentOfLonger(Overlap, Query.Len(), Name.Len());
+}
+
+int32 FVideoNameMatcher::CharBucket(TCHAR Char)
+{
+    if (Char >= TEXT('0') && Char <= TEXT('9'))
+    {
+        return Char - TEXT('0');
+    }
+    if (Char >= TEXT('a') && Char <= TEXT('z'))
+    {
+        return 10 + (Char - TEXT('a'));
+    }
+    return NumCharBuckets - 1;
+}
+
+uint64 FVideoNameMatcher::MakeTrigram(const TCHAR* Chars)
+{
+    constexpr uint64 Mask = (1ull << 21) - 1;
+    return ((static_cast<uint64>(Chars[0]) & Mask) << 42)
+        | ((static_cast<uint64>(Chars[1]) & Mask) << 21)
+        | (static_cast<uint64>(Chars[2]) & Mask);
+}
+
+// Cross-checks the bit-parallel LCS kernels against the scalar DP and times all three, so parity is verified in
+// builds without checkSlow and the four-lane kernel's gain can be read off per query length
+namespace
+{
+    FString MakeBenchmarkName(FRandomStream& Random, int32 Len)
+    {
+        // Normalized names are lowercase alphanumerics; runs from a small vocabulary give realistic overlaps,
+        // and the odd non-ASCII letter exercises the pattern's fallback masks
+        static const TCHAR* const Pieces[] = { TEXT("take"), TEXT("shot"), TEXT("cam"), TEXT("walk"), TEXT("run"),
+            TEXT("idle"), TEXT("jump"), TEXT("left"), TEXT("right"), TEXT("v"), TEXT("final"), TEXT("\u00e9t\u00e9") };
+        FString Name;
+        while (Name.Len() < Len)
+        {
+            if (Random.FRand() < 0.3f)
+            {
+                Name.AppendInt(Random.RandHelper(1000));
+            }
+            else
+            {
+                Name += Pieces[Random.RandHelper(static_cast<int32>(UE_ARRAY_COUNT(Pieces)))];
+            }
+        }
+        return Name.Left(Len);
+    }
+
+    void RunVideoNameLcsBenchmark(int32 NumQueries)
+    {
+        // Every length from 0 to 80 a few times over, then whatever the current video folder holds
+        FRandomStream Random(1234);
+        TArray<FString> Names;
+        for (int32 Round = 0; Round < 4; ++Round)
+        {
+            for (int32 Len = 0; Len <= 80; ++Len)
+            {
+                Names.Add(MakeBenchmarkName(Random, Len));
+            }
+        }
+        const int32 NumGenerated = Names.Num();
+        if (TSharedPtr<const FVideoIndexSnapshot> VideoIndex = FVideoFolderIndex::Get().GetSnapshot())
+        {
+            for (const FVideoIndexEntry& Entry : VideoIndex->Entries)
+            {
+                Names.Add(Entry.NormalizedName);
+            }
+        }
+
+        struct FBucket
+        {
+            const TCHAR* Label;
+            int32 MaxLen;
+            int64 NumPairs = 0;
+            int64 NumLanePairs = 0;
+            double ScalarSeconds = 0.0;
+            double BitParallelSeconds = 0.0;
+            double LaneSeconds = 0.0;
+        };
+        FBucket Buckets[] = { { TEXT("0-16"), 16 }, { TEXT("17-32"), 32 }, { TEXT("33-64"), 64 }, { TEXT("65+"), MAX_int32 } };
+
+        int64 NumMismatches = 0;
+        int64 Checksum = 0;
+        TArray<int32> Scratch;
+        TArray<int32> ScalarLengths;
+        TArray<int32> Lengths;
+        Lengths.SetNumUninitialized(Names.Num());
+        ScalarLengths.SetNumUninitialized(Names.Num());
+
+        auto ReportMismatch = [&NumMismatches](const TCHAR* Kernel, const FString& Query, const FString& Name, int32 Expected, int32 Actual)
+        {
+            if (NumMismatches++ < 10)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] LCS mismatch (%s): \"%s\" vs \"%s\" gave %d, scalar %d"),
+                    Kernel, *Query, *Name, Actual, Expected);
+            }
+        };
+
+        for (int32 QueryNumber = 0; QueryNumber < NumQueries; ++QueryNumber)
+        {
+            // Walk the generated lengths evenly so every bucket gets queries, whatever the index holds
+            const FString& Query = Names[(QueryNumber * 7) % NumGenerated];
+            FBucket* Bucket = Buckets;
+            while (Query.Len() > Bucket->MaxLen)
+            {
+                ++Bucket;
+            }
+
+            double Start = FPlatformTime::Seconds();
+            for (int32 NameIndex = 0; NameIndex < Names.Num(); ++NameIndex)
+            {
+                ScalarLengths[NameIndex] = Query.IsEmpty() || Names[NameIndex].IsEmpty() ? 0 : ScalarLcsLength(Query, Names[NameIndex], Scratch);
+            }
+            Bucket->ScalarSeconds += FPlatformTime::Seconds() - Start;
+            Bucket->NumPairs += Names.Num();
+
+            // What FindBest does per candidate: the query's masks built once, the kernel chosen by length
+            Start = FPlatformTime::Seconds();
+            FLcsPattern PatternStorage;
+            const FLcsPattern* Pattern = PatternStorage.Init(Query) ? &PatternStorage : nullptr;
+            for (int32 NameIndex = 0; NameIndex < Names.Num(); ++NameIndex)
+            {
+                Lengths[NameIndex] = LongestCommonSubsequenceLength(Query, Names[NameIndex], Pattern, Scratch);
+            }
+            Bucket->BitParallelSeconds += FPlatformTime::Seconds() - Start;
+
+            for (int32 NameIndex = 0; NameIndex < Names.Num(); ++NameIndex)
+            {
+                Checksum += Lengths[NameIndex];
+                if (Lengths[NameIndex] != ScalarLengths[NameIndex])
+                {
+                    ReportMismatch(TEXT("bit-parallel"), Query, Names[NameIndex], ScalarLengths[NameIndex], Lengths[NameIndex]);
+                }
+            }
+
+            if (!Pattern || Query.IsEmpty())
+            {
+                continue;
+            }
+
+            Start = FPlatformTime::Seconds();
+            const FString EmptyLane;
+            for (int32 FirstIndex = 0; FirstIndex < Names.Num(); FirstIndex += 4)
+            {
+                const FString* LaneTexts[4];
+                for (int32 Lane = 0; Lane < 4; ++Lane)
+                {
+                    LaneTexts[Lane] = FirstIndex + Lane < Names.Num() ? &Names[FirstIndex + Lane] : &EmptyLane;
+                }
+                int32 LaneLengths[4];
+                BitParallelLcsLengthX4(*Pattern, LaneTexts, LaneLengths);
+                for (int32 Lane = 0; Lane < 4 && FirstIndex + Lane < Names.Num(); ++Lane)
+                {
+                    Lengths[FirstIndex + Lane] = LaneLengths[Lane];
+                }
+            }
+            Bucket->LaneSeconds += FPlatformTime::Seconds() - Start;
+            Bucket->NumLanePairs += Names.Num();
+
+            for (int32 NameIndex = 0; NameIndex < Names.Num(); ++NameIndex)
+            {
+                Checksum += Lengths[NameIndex];
+                if (Lengths[NameIndex] != ScalarLengths[NameIndex])
+                {
+                    ReportMismatch(TEXT("four-lane"), Query, Names[NameIndex], ScalarLengths[NameIndex], Lengths[NameIndex]);
+                }
+            }
+        }
+
+        auto NsPerPair = [](double Seconds, int64 NumPairs) { return NumPairs > 0 ? Seconds * 1.0e9 / static_cast<double>(NumPairs) : 0.0; };
+        UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Video name LCS benchmark: %d queries against %d names (%d generated, %d from the video index), ns/pair:"),
+            NumQueries, Names.Num(), NumGenerated, Names.Num() - NumGenerated);
+        UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer]   Query len      Pairs   Scalar  BitParallel  FourLane"));
+        for (const FBucket& Bucket : Buckets)
+        {
+            UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer]   %9s  %9lld  %7.1f  %11.1f  %8s"), Bucket.Label, Bucket.NumPairs,
+                NsPerPair(Bucket.ScalarSeconds, Bucket.NumPairs), NsPerPair(Bucket.BitParallelSeconds, Bucket.NumPairs),
+                Bucket.NumLanePairs > 0 ? *FString::Printf(TEXT("%.1f"), NsPerPair(Bucket.LaneSeconds, Bucket.NumLanePairs)) : TEXT("-"));
+        }
+        if (NumMismatches > 0)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] %lld LCS mismatches against the scalar DP (checksum %lld)."), NumMismatches, Checksum);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] No LCS mismatches against the scalar DP (checksum %lld)."), Checksum);
+        }
+    }
+
+    FAutoConsoleCommand BenchmarkVideoNameLcsCommand(
+        TEXT("Toucan.BenchmarkVideoNameLcs"),
+        TEXT("Toucan.BenchmarkVideoNameLcs [queries = 64]: checks the bit-parallel LCS kernels against the scalar DP and reports ns/pair for each."),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            const int32 NumQueries = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 100000) : 64;
+            RunVideoNameLcsBenchmark(NumQueries);
+        }));
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include "CoreMinimal.h"
+
+struct FVideoIndexEntry;
+
+/**
+ * Finds the video whose normalized name best matches a queue item.
+ * Gives the same answer as scoring every video with Score() and keeping the first highest score, but
+ * a trigram inverted index picks a strong candidate early and a character-count upper bound then
+ * skips every video that cannot beat it, so the LCS only runs on a handful of names.
+ * Immutable after construction and safe to query from several threads.
+ */
+class FVideoNameMatcher
+{
+public:
+    struct FMatch
+    {
+        int32 EntryIndex = INDEX_NONE;
+        int32 Score = 0;
+    };
+
+    static constexpr int32 DefaultMinimumScore = 55; // below this a name is not trusted as the clip's video
+
+    explicit FVideoNameMatcher(const TArray<FVideoIndexEntry>& Entries);
+
+    /** Best entry scoring at least MinimumScore, lowest index on ties; INDEX_NONE if nothing reaches it */
+    FMatch FindBest(const FString& NormalizedQueueName, int32 MinimumScore) const;
+
+    /** 1000 + shorter length if one name contains the other, else LCS as a percentage of the longer name */
+    static int32 Score(const FString& NormalizedQueueName, const FString& NormalizedVideoName);
+
+private:
+    static constexpr int32 NumCharBuckets = 37; // 0-9, a-z, everything else
+
+    static int32 CharBucket(TCHAR Char);
+    static uint64 MakeTrigram(const TCHAR* Chars);
+    int32 UpperBound(int32 EntryIndex, const FString& Query, const uint16* QueryCounts) const;
+
+    TArray<FString> Names;
+    TArray<uint16> CharCounts; // NumCharBuckets per name
+    TMap<uint64, TArray<int32>> TrigramPostings; // trigram -> ascending entry indices
+};
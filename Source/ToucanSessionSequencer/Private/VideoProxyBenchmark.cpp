@@ -0,0 +1,168 @@
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "MediaProbeCache.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "VideoProxyCache.h"
+#include "VideoProxyProfile.h"
+#include <atomic>
+
+// Encodes a short excerpt of a clip with every proxy profile, then times ffmpeg decoding it straight through
+// and decoding single frames after seeks. Process start-up is measured separately and subtracted from seeks.
+// Results go to the log and Saved/ToucanSessionSequencer/ProxyBenchmark.csv.
+namespace
+{
+    std::atomic<bool> bBenchmarkRunning{ false };
+
+    bool RunTimed(const FString& Args, double& OutSeconds)
+    {
+        int32 ReturnCode = 0;
+        FString StdOut;
+        FString StdErr;
+        const double Start = FPlatformTime::Seconds();
+        const bool bLaunched = FPlatformProcess::ExecProcess(TEXT("ffmpeg"), *Args, &ReturnCode, &StdOut, &StdErr);
+        OutSeconds = FPlatformTime::Seconds() - Start;
+        if (!bLaunched || ReturnCode != 0)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Benchmark ffmpeg call failed (%d): %s"), ReturnCode, *StdErr);
+            return false;
+        }
+        return true;
+    }
+
+    // ffmpeg input arguments for a benchmark output, which is a directory of frames for image-sequence profiles
+    FString MakeInputArgs(const FVideoProxyProfile& Profile, const FString& OutputPath, double FramesPerSecond)
+    {
+        return Profile.bImageSequence
+            ? FString::Printf(TEXT("-framerate %.6f -start_number 0 -i \"%s\""), FramesPerSecond, *(OutputPath / Profile.GetFramePattern()))
+            : FString::Printf(TEXT("-i \"%s\""), *OutputPath);
+    }
+
+    double TimeFirstFrame(const FString& InputArgs, double SeekSeconds)
+    {
+        double Seconds = 0.0;
+        const FString Args = FString::Printf(TEXT("-v error -ss %.3f %s -frames:v 1 -f null -"), SeekSeconds, *InputArgs);
+        return RunTimed(Args, Seconds) ? Seconds : -1.0;
+    }
+
+    void RunBenchmark(const FString& SourcePath, double ExcerptSeconds, int32 NumSeeks)
+    {
+        FMediaProbeInfo SourceInfo;
+        if (FMediaProbeCache::Get().Probe(SourcePath, SourceInfo) != EMediaProbeResult::Success)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Benchmark skipped: could not probe %s"), *SourcePath);
+            return;
+        }
+
+        ExcerptSeconds = SourceInfo.DurationSeconds > 0.0 ? FMath::Min(ExcerptSeconds, SourceInfo.DurationSeconds) : ExcerptSeconds;
+        const double FramesPerSecond = SourceInfo.FrameRate.AsDecimal() > 0.0 ? SourceInfo.FrameRate.AsDecimal() : 30.0;
+        const int32 NumFrames = FMath::Max(1, FMath::RoundToInt(ExcerptSeconds * FramesPerSecond));
+
+        const FString WorkDir = FPaths::ProjectSavedDir() / TEXT("ToucanSessionSequencer/ProxyBenchmark");
+        IFileManager::Get().MakeDirectory(*WorkDir, true);
+
+        FString Csv = TEXT("Profile,EncodeSeconds,SizeMB,DecodeMsPerFrame,SeekMsAvg,SeekMsMax\n");
+        UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Proxy benchmark: %s, %.1fs excerpt (%d frames), %d seeks"), *SourcePath, ExcerptSeconds, NumFrames, NumSeeks);
+
+        for (const FVideoProxyProfile& Profile : FVideoProxyProfiles::Get().GetAll())
+        {
+            const FString OutputPath = Profile.bImageSequence
+                ? WorkDir / Profile.Name
+                : WorkDir / FString::Printf(TEXT("%s.%s"), *Profile.Name, *Profile.Container);
+            const FString OutputTarget = Profile.bImageSequence
+                ? FString::Printf(TEXT("-start_number 0 \"%s\""), *(OutputPath / Profile.GetFramePattern()))
+                : FString::Printf(TEXT("\"%s\""), *OutputPath);
+            FVideoProxyCache::DeleteProxy(OutputPath);
+            if (Profile.bImageSequence)
+            {
+                IFileManager::Get().MakeDirectory(*OutputPath, true);
+            }
+
+            double EncodeSeconds = 0.0;
+            const FString EncodeArgs = FString::Printf(
+                TEXT("-y -hide_banner -loglevel error -t %.3f -i \"%s\" -vf %s %s -an -f %s %s"),
+                ExcerptSeconds, *SourcePath, *Profile.GetScaleFilter(SourceInfo.Resolution), *Profile.GetCodecArgs(), *Profile.GetMuxerName(), *OutputTarget);
+            if (!RunTimed(EncodeArgs, EncodeSeconds))
+            {
+                FVideoProxyCache::DeleteProxy(OutputPath);
+                continue;
+            }
+
+            const FString InputArgs = MakeInputArgs(Profile, OutputPath, FramesPerSecond);
+            double DecodeSeconds = 0.0;
+            RunTimed(FString::Printf(TEXT("-v error %s -f null -"), *InputArgs), DecodeSeconds);
+
+            // Seek targets spread evenly over the excerpt, each visited once in shuffled order like a jog wheel would
+            const double Baseline = FMath::Max(TimeFirstFrame(InputArgs, 0.0), 0.0);
+            double SeekTotal = 0.0;
+            double SeekMax = 0.0;
+            int32 NumTimed = 0;
+            TArray<int32> SeekSlots;
+            for (int32 Slot = 0; Slot < NumSeeks; ++Slot)
+            {
+                SeekSlots.Add(Slot);
+            }
+            FRandomStream Random(NumSeeks); // same order every run, so profiles are compared on the same seeks
+            for (int32 Index = SeekSlots.Num() - 1; Index > 0; --Index)
+            {
+                SeekSlots.Swap(Index, Random.RandRange(0, Index));
+            }
+
+            for (const int32 Slot : SeekSlots)
+            {
+                const double Target = ExcerptSeconds * (Slot + 0.5) / NumSeeks;
+                const double Seconds = TimeFirstFrame(InputArgs, Target);
+                if (Seconds >= 0.0)
+                {
+                    const double Latency = FMath::Max(Seconds - Baseline, 0.0);
+                    SeekTotal += Latency;
+                    SeekMax = FMath::Max(SeekMax, Latency);
+                    ++NumTimed;
+                }
+            }
+
+            const double SizeMB = FVideoProxyCache::GetProxySize(OutputPath) / (1024.0 * 1024.0);
+            const double DecodeMsPerFrame = 1000.0 * DecodeSeconds / NumFrames;
+            const double SeekMsAvg = NumTimed > 0 ? 1000.0 * SeekTotal / NumTimed : 0.0;
+            UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer]   %-10s encode %6.1fs  %7.1f MB  decode %6.2f ms/frame  seek avg %6.1f ms  max %6.1f ms"),
+                *Profile.Name, EncodeSeconds, SizeMB, DecodeMsPerFrame, SeekMsAvg, 1000.0 * SeekMax);
+            Csv += FString::Printf(TEXT("%s,%.2f,%.1f,%.3f,%.1f,%.1f\n"), *Profile.Name, EncodeSeconds, SizeMB, DecodeMsPerFrame, SeekMsAvg, 1000.0 * SeekMax);
+
+            FVideoProxyCache::DeleteProxy(OutputPath);
+        }
+
+        const FString CsvPath = FPaths::ProjectSavedDir() / TEXT("ToucanSessionSequencer/ProxyBenchmark.csv");
+        FFileHelper::SaveStringToFile(Csv, *CsvPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+        UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Proxy benchmark written to %s"), *CsvPath);
+    }
+
+    FAutoConsoleCommand BenchmarkProxyProfilesCommand(
+        TEXT("Toucan.BenchmarkProxyProfiles"),
+        TEXT("Toucan.BenchmarkProxyProfiles <clip path> [excerpt seconds = 10] [seeks = 8]: encode, decode and seek timings for every video proxy profile."),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            if (Args.Num() == 0 || !FPaths::FileExists(Args[0]))
+            {
+                UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Usage: Toucan.BenchmarkProxyProfiles <clip path> [excerpt seconds] [seeks]"));
+                return;
+            }
+            if (bBenchmarkRunning.exchange(true))
+            {
+                UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] A proxy benchmark is already running."));
+                return;
+            }
+
+            const FString SourcePath = Args[0];
+            const double ExcerptSeconds = Args.Num() > 1 ? FMath::Max(FCString::Atod(*Args[1]), 1.0) : 10.0;
+            const int32 NumSeeks = Args.Num() > 2 ? FMath::Clamp(FCString::Atoi(*Args[2]), 1, 64) : 8;
+            Async(EAsyncExecution::Thread, [SourcePath, ExcerptSeconds, NumSeeks]()
+            {
+                RunBenchmark(SourcePath, ExcerptSeconds, NumSeeks);
+                bBenchmarkRunning = false;
+            });
+        }));
+}
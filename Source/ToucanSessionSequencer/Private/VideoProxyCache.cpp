@@ -0,0 +1,352 @@
+#include "VideoProxyCache.h"
+#include "HAL/FileManager.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "SeqQueue.h"
+#include "VideoProxyQueue.h"
+
+namespace
+{
+    constexpr const TCHAR* ManifestHeader = TEXT("TOUCANX\t2");
+    constexpr const TCHAR* ManifestHeaderV1 = TEXT("TOUCANX\t1"); // no profile column
+    constexpr int64 DefaultBudgetMB = 50 * 1024;
+
+    FString GetManifestPath()
+    {
+        return FVideoProxyCache::GetProxyDirectory() / TEXT("Manifest.tsv");
+    }
+}
+
+FVideoProxyCache::FVideoProxyCache()
+{
+#if WITH_EDITOR
+    const FString& Ini = GEditorPerProjectIni;
+#else
+    const FString& Ini = GGameIni;
+#endif
+    int32 BudgetMB = static_cast<int32>(DefaultBudgetMB);
+    GConfig->GetInt(ConfigSection, BudgetMBKey, BudgetMB, Ini);
+    BudgetBytes = static_cast<int64>(FMath::Max(BudgetMB, 0)) * 1024 * 1024;
+}
+
+FString FVideoProxyCache::GetProxyDirectory()
+{
+    return FPaths::ProjectSavedDir() / TEXT("ToucanSessionSequencer/VideoProxies");
+}
+
+bool FVideoProxyCache::ProxyExists(const FString& ProxyPath)
+{
+    return FPaths::FileExists(ProxyPath) || FPaths::DirectoryExists(ProxyPath);
+}
+
+int64 FVideoProxyCache::GetProxySize(const FString& ProxyPath)
+{
+    if (!FPaths::DirectoryExists(ProxyPath))
+    {
+        return FMath::Max<int64>(IFileManager::Get().FileSize(*ProxyPath), 0);
+    }
+
+    int64 Total = 0;
+    IFileManager::Get().IterateDirectoryStatRecursively(*ProxyPath, [&Total](const TCHAR*, const FFileStatData& Stat)
+    {
+        Total += Stat.bIsDirectory ? 0 : Stat.FileSize;
+        return true;
+    });
+    return Total;
+}
+
+bool FVideoProxyCache::DeleteProxy(const FString& ProxyPath)
+{
+    if (FPaths::DirectoryExists(ProxyPath))
+    {
+        return IFileManager::Get().DeleteDirectory(*ProxyPath, false, true);
+    }
+    return !FPaths::FileExists(ProxyPath) || IFileManager::Get().Delete(*ProxyPath, false, true, true);
+}
+
+void FVideoProxyCache::Initialize()
+{
+    if (bInitialized)
+    {
+        return;
+    }
+    bInitialized = true;
+
+    TArray<FString> Lines;
+    if (FFileHelper::LoadFileToStringArray(Lines, *GetManifestPath()) && Lines.Num() > 0
+        && (Lines[0] == ManifestHeader || Lines[0] == ManifestHeaderV1))
+    {
+        const int32 NumFields = Lines[0] == ManifestHeader ? 5 : 4;
+        for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+        {
+            // size, last access ticks, proxy file name, profile, source key; the key holds a path so it goes last
+            TArray<FString> Fields;
+            Lines[LineIndex].ParseIntoArray(Fields, TEXT("\t"), false);
+            if (Fields.Num() != NumFields || Fields[2].IsEmpty())
+            {
+                continue;
+            }
+
+            FEntry& Entry = Entries.Add(Fields[2]);
+            Entry.Size = FCString::Atoi64(*Fields[0]);
+            Entry.LastAccess = FDateTime(FCString::Atoi64(*Fields[1]));
+            Entry.SourceKey = Fields.Last();
+            if (NumFields == 5)
+            {
+                Entry.ProfileName = Fields[3];
+            }
+        }
+    }
+
+    Reconcile();
+    EnforceBudget();
+}
+
+void FVideoProxyCache::RecordProxy(const FString& ProxyPath, const FString& SourceKey, const FString& ProfileName)
+{
+    Initialize();
+
+    FEntry& Entry = Entries.FindOrAdd(FPaths::GetCleanFilename(ProxyPath));
+    Entry.Size = GetProxySize(ProxyPath);
+    Entry.LastAccess = FDateTime::UtcNow();
+    Entry.SourceKey = SourceKey;
+    Entry.ProfileName = ProfileName;
+    EnforceBudget();
+    SaveManifest();
+}
+
+void FVideoProxyCache::Touch(const FString& ProxyPath)
+{
+    Initialize();
+
+    if (FEntry* Entry = FindEntry(ProxyPath))
+    {
+        // Minute resolution is plenty for LRU and keeps repeated touches from rewriting the manifest
+        const FDateTime Now = FDateTime::UtcNow();
+        if (Now - Entry->LastAccess >= FTimespan::FromMinutes(1.0))
+        {
+            Entry->LastAccess = Now;
+            SaveManifest();
+        }
+    }
+    else if (ProxyExists(ProxyPath))
+    {
+        RecordProxy(ProxyPath, FString(), FString());
+    }
+}
+
+bool FVideoProxyCache::Contains(const FString& ProxyPath)
+{
+    Initialize();
+    return FindEntry(ProxyPath) != nullptr;
+}
+
+void FVideoProxyCache::MarkInUse(const FString& ProxyPath)
+{
+    InUseFileName = FPaths::GetCleanFilename(ProxyPath);
+    Touch(ProxyPath);
+}
+
+void FVideoProxyCache::SetLookAheadProxies(const TSet<FString>& ProxyPaths)
+{
+    LookAheadFileNames.Reset();
+    for (const FString& ProxyPath : ProxyPaths)
+    {
+        LookAheadFileNames.Add(FPaths::GetCleanFilename(ProxyPath));
+    }
+}
+
+void FVideoProxyCache::EnforceBudget()
+{
+    if (BudgetBytes <= 0)
+    {
+        return;
+    }
+
+    int64 TotalBytes = 0;
+    for (const TPair<FString, FEntry>& Pair : Entries)
+    {
+        TotalBytes += Pair.Value.Size;
+    }
+    if (TotalBytes <= BudgetBytes)
+    {
+        return;
+    }
+
+    const TSet<FString> Protected = GatherProtectedFileNames();
+    TArray<FString> Candidates;
+    for (const TPair<FString, FEntry>& Pair : Entries)
+    {
+        if (!Protected.Contains(Pair.Key))
+        {
+            Candidates.Add(Pair.Key);
+        }
+    }
+    Candidates.Sort([this](const FString& A, const FString& B) { return Entries[A].LastAccess < Entries[B].LastAccess; });
+
+    const FString ProxyDir = GetProxyDirectory();
+    int32 NumEvicted = 0;
+    for (const FString& FileName : Candidates)
+    {
+        if (TotalBytes <= BudgetBytes)
+        {
+            break;
+        }
+
+        const FString ProxyPath = ProxyDir / FileName;
+        if (!DeleteProxy(ProxyPath))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Could not evict video proxy (in use?): %s"), *ProxyPath);
+            continue;
+        }
+
+        TotalBytes -= Entries[FileName].Size;
+        Entries.Remove(FileName);
+        ++NumEvicted;
+    }
+
+    if (NumEvicted > 0)
+    {
+        UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Evicted %d video proxies; cache now %.1f GB of %.1f GB."),
+            NumEvicted, TotalBytes / 1073741824.0, BudgetBytes / 1073741824.0);
+        SaveManifest();
+    }
+    else if (TotalBytes > BudgetBytes)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Video proxy cache is over budget but every proxy belongs to a queued clip."));
+    }
+}
+
+void FVideoProxyCache::Reconcile()
+{
+    // Files on disk are the truth: adopt unknown proxies, forget entries whose file is gone,
+    // and clear out partial encodes left behind by a crash
+    TMap<FString, int64> OnDisk; // proxy file name -> bytes
+    TMap<FString, FDateTime> OnDiskModified;
+    TArray<FString> StalePartials;
+    IFileManager::Get().IterateDirectoryStat(*GetProxyDirectory(), [&OnDisk, &OnDiskModified, &StalePartials](const TCHAR* FilenameOrDirectory, const FFileStatData& Stat)
+    {
+        const FString FilePath(FilenameOrDirectory);
+        const FString Extension = FPaths::GetExtension(FilePath).ToLower();
+        if (Extension == TEXT("part"))
+        {
+            StalePartials.Add(FilePath);
+        }
+        else if (Stat.bIsDirectory || (Extension != TEXT("tsv") && Extension != TEXT("tmp"))) // anything else is a proxy, whatever its profile's container
+        {
+            const FString FileName = FPaths::GetCleanFilename(FilePath);
+            OnDisk.Add(FileName, Stat.bIsDirectory ? GetProxySize(FilePath) : Stat.FileSize);
+            OnDiskModified.Add(FileName, Stat.ModificationTime);
+        }
+        return true;
+    });
+
+    int32 NumPartialsRemoved = 0;
+    for (const FString& Partial : StalePartials)
+    {
+        if (!FVideoProxyQueue::Get().IsPending(Partial.LeftChop(5))) // strip ".part"
+        {
+            DeleteProxy(Partial);
+            ++NumPartialsRemoved;
+        }
+    }
+
+    int32 NumForgotten = 0;
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        if (!OnDisk.Contains(It.Key()))
+        {
+            It.RemoveCurrent();
+            ++NumForgotten;
+        }
+    }
+
+    int32 NumAdopted = 0;
+    for (const TPair<FString, int64>& Pair : OnDisk)
+    {
+        FEntry* Entry = Entries.Find(Pair.Key);
+        if (!Entry)
+        {
+            Entry = &Entries.Add(Pair.Key);
+            Entry->LastAccess = OnDiskModified[Pair.Key];
+            ++NumAdopted;
+        }
+        Entry->Size = Pair.Value;
+    }
+
+    if (NumAdopted > 0 || NumForgotten > 0 || NumPartialsRemoved > 0)
+    {
+        UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Reconciled video proxy cache: %d proxies, %d adopted, %d missing, %d partial encodes removed."),
+            Entries.Num(), NumAdopted, NumForgotten, NumPartialsRemoved);
+        SaveManifest();
+    }
+}
+
+void FVideoProxyCache::SaveManifest() const
+{
+    TStringBuilder<4096> Text;
+    Text << ManifestHeader << TEXT("\n");
+    for (const TPair<FString, FEntry>& Pair : Entries)
+    {
+        Text << Pair.Value.Size << TEXT("\t") << Pair.Value.LastAccess.GetTicks() << TEXT("\t") << Pair.Key << TEXT("\t") << Pair.Value.ProfileName << TEXT("\t") << Pair.Value.SourceKey << TEXT("\n");
+    }
+
+    const FString TempPath = GetManifestPath() + TEXT(".tmp");
+    if (!FFileHelper::SaveStringToFile(Text.ToView(), *TempPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+        || !IFileManager::Get().Move(*GetManifestPath(), *TempPath, true, true))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Failed to write video proxy manifest: %s"), *GetManifestPath());
+    }
+}
+
+TSet<FString> FVideoProxyCache::GatherProtectedFileNames() const
+{
+    // Exact proxy names only: the one playing, and the ones the prefetcher is keeping ready for upcoming clips
+    TSet<FString> Protected = LookAheadFileNames;
+    if (!InUseFileName.IsEmpty())
+    {
+        Protected.Add(InUseFileName);
+    }
+
+    TSet<FString> WaitingSources;
+    for (const FQueuedAnim& Item : FSeqQueue::Get().GetAll())
+    {
+        if (!Item.bProcessed && !Item.MatchedVideoPath.IsEmpty())
+        {
+            WaitingSources.Add(Item.MatchedVideoPath);
+        }
+    }
+    if (WaitingSources.IsEmpty())
+    {
+        return Protected;
+    }
+
+    // Beyond the look-ahead, queued clips with a stored match keep their active-profile proxy. The manifest records
+    // each proxy's source and profile, so nothing here touches the disk; entries written before profiles were
+    // recorded count for every profile.
+    const FString& ActiveProfileName = FVideoProxyProfiles::Get().GetActive().Name;
+    for (const TPair<FString, FEntry>& Pair : Entries)
+    {
+        if (Pair.Value.SourceKey.IsEmpty() || (!Pair.Value.ProfileName.IsEmpty() && Pair.Value.ProfileName != ActiveProfileName))
+        {
+            continue;
+        }
+
+        // "path|size|mtime": drop the two trailing fields to get the source path back
+        const FStringView SourcePath = Pair.Value.SourceKey;
+        int32 Separator = INDEX_NONE;
+        if (SourcePath.FindLastChar(TEXT('|'), Separator)
+            && SourcePath.Left(Separator).FindLastChar(TEXT('|'), Separator)
+            && WaitingSources.Contains(FString(SourcePath.Left(Separator))))
+        {
+            Protected.Add(Pair.Key);
+        }
+    }
+    return Protected;
+}
+
+FVideoProxyCache::FEntry* FVideoProxyCache::FindEntry(const FString& ProxyPath)
+{
+    return Entries.Find(FPaths::GetCleanFilename(ProxyPath));
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "CoreMinimal.h"
+
+/**
+ * Manifest of the review proxies in Saved/ToucanSessionSequencer/VideoProxies, with least-recently-used
+ * eviction once their total size passes a byte budget. Proxies for clips still waiting in the queue and
+ * the proxy that is currently playing are never evicted. Game thread only.
+ */
+class FVideoProxyCache
+{
+public:
+    static FVideoProxyCache& Get()
+    {
+        static FVideoProxyCache S;
+        return S;
+    }
+
+    static FString GetProxyDirectory();
+
+    // A proxy is a single movie file, or a directory of numbered frames for image-sequence profiles
+    static bool ProxyExists(const FString& ProxyPath);
+    static int64 GetProxySize(const FString& ProxyPath);
+    static bool DeleteProxy(const FString& ProxyPath);
+
+    void Initialize(); // loads the manifest and reconciles it with the directory
+    void RecordProxy(const FString& ProxyPath, const FString& SourceKey, const FString& ProfileName); // a new proxy landed
+    void Touch(const FString& ProxyPath);
+    bool Contains(const FString& ProxyPath); // from the manifest, without touching the disk
+    void MarkInUse(const FString& ProxyPath); // touches and protects it until another proxy is marked
+    void SetLookAheadProxies(const TSet<FString>& ProxyPaths); // the prefetcher's window; protected until it changes
+    void EnforceBudget();
+
+private:
+    struct FEntry
+    {
+        int64 Size = 0;
+        FDateTime LastAccess;
+        FString SourceKey; // FMediaProbeCache::MakeSourceKey of the source; empty for files found on disk
+        FString ProfileName; // profile it was encoded with; empty for files found on disk
+    };
+
+    FVideoProxyCache();
+
+    void Reconcile();
+    void SaveManifest() const;
+    TSet<FString> GatherProtectedFileNames() const;
+    FEntry* FindEntry(const FString& ProxyPath);
+
+    TMap<FString, FEntry> Entries; // by proxy file name
+    FString InUseFileName;
+    TSet<FString> LookAheadFileNames;
+    int64 BudgetBytes = 0; // 0 disables eviction
+    bool bInitialized = false;
+
+    static constexpr const TCHAR* ConfigSection = TEXT("ToucanSequencer");
+    static constexpr const TCHAR* BudgetMBKey = TEXT("ProxyCacheBudgetMB");
+};
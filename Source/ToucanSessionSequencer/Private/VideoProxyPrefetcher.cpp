@@ -0,0 +1,221 @@
+#include "VideoProxyPrefetcher.h"
+#include "Async/Async.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/Paths.h"
+#include "MediaProbeCache.h"
+#include "SeqQueue.h"
+#include "VideoFolderIndex.h"
+#include "VideoNameMatcher.h"
+#include "VideoProxyCache.h"
+#include "VideoProxyQueue.h"
+
+namespace
+{
+    // Items with no video anywhere don't use up the look-ahead, but the walk for them stays bounded
+    constexpr int32 MaxItemsExaminedPerSlot = 8;
+}
+
+FVideoProxyPrefetcher::FVideoProxyPrefetcher()
+{
+#if WITH_EDITOR
+    const FString& Ini = GEditorPerProjectIni;
+#else
+    const FString& Ini = GGameIni;
+#endif
+    GConfig->GetInt(ConfigSection, LookAheadCountKey, LookAheadCount, Ini);
+    LookAheadCount = FMath::Clamp(LookAheadCount, 0, 32);
+}
+
+void FVideoProxyPrefetcher::Start()
+{
+    if (bRunning)
+    {
+        return;
+    }
+
+    bRunning = true;
+    QueueChangedHandle = FSeqQueue::Get().OnQueueChanged().AddRaw(this, &FVideoProxyPrefetcher::Refresh);
+    IndexUpdatedHandle = FVideoFolderIndex::Get().OnIndexUpdated().AddRaw(this, &FVideoProxyPrefetcher::OnVideoIndexUpdated);
+    Refresh();
+}
+
+void FVideoProxyPrefetcher::Shutdown()
+{
+    if (!bRunning)
+    {
+        return;
+    }
+
+    bRunning = false;
+    FSeqQueue::Get().OnQueueChanged().Remove(QueueChangedHandle);
+    QueueChangedHandle.Reset();
+    FVideoFolderIndex::Get().OnIndexUpdated().Remove(IndexUpdatedHandle);
+    IndexUpdatedHandle.Reset();
+    FVideoProxyQueue::Get().RetainBackground(TSet<FString>());
+    FVideoProxyCache::Get().SetLookAheadProxies(TSet<FString>());
+}
+
+void FVideoProxyPrefetcher::Refresh()
+{
+    if (!bRunning || LookAheadCount <= 0)
+    {
+        return;
+    }
+
+    // The items "Load next" will reach, in order, stopping before the current one comes round again
+    const FSeqQueue& Queue = FSeqQueue::Get();
+    const TArray<FQueuedAnim>& Items = Queue.GetAll();
+    const int32 CurrentIndex = Queue.GetCurrentIndex();
+    const TSharedPtr<const FVideoIndexSnapshot> VideoIndex = FVideoFolderIndex::Get().GetSnapshot();
+    const FVideoProxyProfile& Profile = FVideoProxyProfiles::Get().GetActive();
+
+    TSet<FString> WantedProxyPaths;
+    int32 NumPlanned = 0;
+    int32 NumExamined = 0;
+    const int32 FirstIndex = Queue.FindNextUnprocessed(CurrentIndex);
+    for (int32 Index = FirstIndex; Index != INDEX_NONE && Index != CurrentIndex; )
+    {
+        if (NumPlanned >= LookAheadCount || NumExamined++ >= LookAheadCount * MaxItemsExaminedPerSlot)
+        {
+            break;
+        }
+
+        const FString SourcePath = FindVideoFor(Items[Index], VideoIndex.Get());
+        if (!SourcePath.IsEmpty())
+        {
+            ++NumPlanned;
+            ConsiderVideo(SourcePath, Profile, WantedProxyPaths);
+        }
+
+        Index = Queue.FindNextUnprocessed(Index);
+        if (Index == FirstIndex)
+        {
+            break;
+        }
+    }
+
+    // Items that fell out of the window no longer need their queued encodes; the ones in it keep their proxies
+    FVideoProxyQueue::Get().RetainBackground(WantedProxyPaths);
+    FVideoProxyCache::Get().SetLookAheadProxies(WantedProxyPaths);
+}
+
+FString FVideoProxyPrefetcher::FindVideoFor(const FQueuedAnim& Item, const FVideoIndexSnapshot* VideoIndex)
+{
+    // A stored match is trusted while the index still lists it, or before there is an index to ask
+    if (!Item.MatchedVideoPath.IsEmpty() && (!VideoIndex || VideoIndex->ContainsFile(Item.MatchedVideoPath)))
+    {
+        return Item.MatchedVideoPath;
+    }
+    if (!VideoIndex || !VideoIndex->Matcher.IsValid())
+    {
+        return FString();
+    }
+
+    // Same matching the window does when the clip is opened; remembered until the index changes
+    if (const FString* Known = IndexMatches.Find(Item.Path))
+    {
+        return *Known;
+    }
+
+    const FString QueueName = Item.DisplayName.IsEmpty() ? Item.Path.GetAssetName() : Item.DisplayName.ToString();
+    const FVideoNameMatcher::FMatch Match = VideoIndex->Matcher->FindBest(FVideoFolderIndex::NormalizeName(QueueName), FVideoNameMatcher::DefaultMinimumScore);
+    return IndexMatches.Add(Item.Path, Match.EntryIndex != INDEX_NONE ? VideoIndex->Entries[Match.EntryIndex].FilePath : FString());
+}
+
+void FVideoProxyPrefetcher::ConsiderVideo(const FString& SourcePath, const FVideoProxyProfile& Profile, TSet<FString>& OutWantedProxyPaths)
+{
+    const FPlannedSource* Planned = PlannedSources.Find(SourcePath);
+    if (!Planned || Planned->ProfileSignature != Profile.GetSignature())
+    {
+        if (bProbeUnavailable || FailedProbes.Contains(SourcePath) || ProbesInFlight.Contains(SourcePath))
+        {
+            return;
+        }
+
+        // Existence, the probe and the proxy name all stat the share, so none of it runs on the game thread
+        ProbesInFlight.Add(SourcePath);
+        Async(EAsyncExecution::ThreadPool, [SourcePath, Profile, Serial = PlanSerial]()
+        {
+            FPlannedSource BackgroundPlan;
+            EMediaProbeResult Result = EMediaProbeResult::Failed;
+            if (FPaths::FileExists(SourcePath))
+            {
+                Result = FMediaProbeCache::Get().Probe(SourcePath, BackgroundPlan.ProbeInfo);
+                if (Result == EMediaProbeResult::Success)
+                {
+                    BackgroundPlan.ProxyPath = FVideoProxyQueue::GetCachedVideoProxyPath(SourcePath, Profile);
+                    BackgroundPlan.ProfileSignature = Profile.GetSignature();
+                }
+            }
+            AsyncTask(ENamedThreads::GameThread, [SourcePath, Serial, Result, BackgroundPlan = MoveTemp(BackgroundPlan)]()
+            {
+                FVideoProxyPrefetcher::Get().OnProbeFinished(SourcePath, Serial, Result, BackgroundPlan);
+            });
+        });
+        return;
+    }
+
+    if (!Profile.NeedsProxy(Planned->ProbeInfo.Resolution))
+    {
+        return;
+    }
+
+    const FString& ProxyPath = Planned->ProxyPath;
+    OutWantedProxyPaths.Add(ProxyPath);
+    if (FVideoProxyCache::Get().Contains(ProxyPath))
+    {
+        FVideoProxyCache::Get().Touch(ProxyPath); // about to be needed; keep it away from the eviction end
+        return;
+    }
+    if (FVideoProxyQueue::Get().IsPending(ProxyPath))
+    {
+        return;
+    }
+
+    FVideoProxyQueue::FRequest Request;
+    Request.SourcePath = SourcePath;
+    Request.ProxyPath = ProxyPath;
+    Request.SourceResolution = Planned->ProbeInfo.Resolution;
+    Request.DurationSeconds = Planned->ProbeInfo.DurationSeconds;
+    Request.Profile = Profile;
+    Request.Priority = FVideoProxyQueue::EPriority::Background;
+    FVideoProxyQueue::Get().Enqueue(Request);
+    UE_LOG(LogTemp, Verbose, TEXT("[ToucanSequencer] Prefetching review proxy: %s"), *ProxyPath);
+}
+
+void FVideoProxyPrefetcher::OnProbeFinished(const FString& SourcePath, uint32 Serial, EMediaProbeResult Result, const FPlannedSource& Planned)
+{
+    ProbesInFlight.Remove(SourcePath);
+    if (Result == EMediaProbeResult::MissingExecutable)
+    {
+        bProbeUnavailable = true;
+        return;
+    }
+    if (Serial != PlanSerial)
+    {
+        return;
+    }
+
+    if (Result != EMediaProbeResult::Success)
+    {
+        FailedProbes.Add(SourcePath);
+    }
+    else
+    {
+        PlannedSources.Add(SourcePath, Planned);
+        if (bRunning)
+        {
+            Refresh();
+        }
+    }
+}
+
+void FVideoProxyPrefetcher::OnVideoIndexUpdated()
+{
+    // Files may have been replaced, added or removed; everything learned about them starts over
+    ++PlanSerial;
+    PlannedSources.Reset();
+    IndexMatches.Reset();
+    FailedProbes.Reset();
+    Refresh();
+}
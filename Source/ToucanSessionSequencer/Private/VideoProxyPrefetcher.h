@@ -0,0 +1,59 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "MediaProbeCache.h"
+#include "UObject/SoftObjectPath.h"
+
+struct FQueuedAnim;
+struct FVideoIndexSnapshot;
+struct FVideoProxyProfile;
+
+/**
+ * Keeps review proxies ready for the next few unprocessed queue items, so opening the next clip
+ * finds its proxy already in the cache. Items without a stored match are matched against the video index.
+ * Probing a source and naming its proxy happen on the thread pool and are remembered until the index changes,
+ * so re-planning on every queue change never touches the share; encodes go through FVideoProxyQueue at
+ * background priority. Game thread only.
+ */
+class FVideoProxyPrefetcher
+{
+public:
+    static FVideoProxyPrefetcher& Get()
+    {
+        static FVideoProxyPrefetcher S;
+        return S;
+    }
+
+    void Start(); // follows FSeqQueue from now on
+    void Shutdown();
+    void Refresh(); // re-plans the look-ahead window now
+
+private:
+    /** What the worker found out about a source for one proxy profile */
+    struct FPlannedSource
+    {
+        FMediaProbeInfo ProbeInfo;
+        FString ProxyPath;
+        FString ProfileSignature;
+    };
+
+    FVideoProxyPrefetcher();
+
+    FString FindVideoFor(const FQueuedAnim& Item, const FVideoIndexSnapshot* VideoIndex);
+    void ConsiderVideo(const FString& SourcePath, const FVideoProxyProfile& Profile, TSet<FString>& OutWantedProxyPaths);
+    void OnProbeFinished(const FString& SourcePath, uint32 Serial, EMediaProbeResult Result, const FPlannedSource& Planned);
+    void OnVideoIndexUpdated();
+
+    TMap<FString, FPlannedSource> PlannedSources; // by source path
+    TMap<FSoftObjectPath, FString> IndexMatches; // items without a stored match -> best video in the index, empty if none
+    TSet<FString> FailedProbes; // missing or unprobeable; retried once the index changes
+    TSet<FString> ProbesInFlight;
+    uint32 PlanSerial = 0; // bumped when the index changes so results planned against the old one are dropped
+    FDelegateHandle QueueChangedHandle;
+    FDelegateHandle IndexUpdatedHandle;
+    int32 LookAheadCount = 3;
+    bool bProbeUnavailable = false; // ffprobe missing; stop trying for this session
+    bool bRunning = false;
+
+    static constexpr const TCHAR* ConfigSection = TEXT("ToucanSequencer");
+    static constexpr const TCHAR* LookAheadCountKey = TEXT("ProxyPrefetchCount"); // 0 disables prefetching
+};
@@ -0,0 +1,163 @@
+#include "VideoProxyProfile.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+    bool IsCrfCodec(const FString& Codec)
+    {
+        return Codec.StartsWith(TEXT("libx264")) || Codec.StartsWith(TEXT("libx265"));
+    }
+
+    FVideoProxyProfile MakeBuiltIn(const TCHAR* Name, int32 ShortSide, const TCHAR* Codec, int32 Quality, const TCHAR* PixelFormat, const TCHAR* Container, const TCHAR* ExtraArgs, bool bTranscodeAll)
+    {
+        FVideoProxyProfile Profile;
+        Profile.Name = Name;
+        Profile.ShortSide = ShortSide;
+        Profile.Codec = Codec;
+        Profile.Quality = Quality;
+        Profile.PixelFormat = PixelFormat;
+        Profile.Container = Container;
+        Profile.ExtraArgs = ExtraArgs;
+        Profile.bTranscodeAll = bTranscodeAll;
+        return Profile;
+    }
+}
+
+bool FVideoProxyProfile::NeedsProxy(const FIntPoint& SourceResolution) const
+{
+    if (bTranscodeAll)
+    {
+        return true;
+    }
+
+    const int32 SourceShort = FMath::Min(SourceResolution.X, SourceResolution.Y);
+    const int32 SourceLong = FMath::Max(SourceResolution.X, SourceResolution.Y);
+    return SourceShort > ShortSide || SourceLong > ShortSide * 16 / 9;
+}
+
+FString FVideoProxyProfile::GetScaleFilter(const FIntPoint& SourceResolution) const
+{
+    // Never upscale; -2 keeps the aspect ratio with an even dimension
+    const int32 TargetShort = FMath::Min(ShortSide, FMath::Min(SourceResolution.X, SourceResolution.Y));
+    return SourceResolution.X >= SourceResolution.Y
+        ? FString::Printf(TEXT("scale=-2:%d"), TargetShort)
+        : FString::Printf(TEXT("scale=%d:-2"), TargetShort);
+}
+
+FString FVideoProxyProfile::GetCodecArgs() const
+{
+    FString Args = IsCrfCodec(Codec)
+        ? FString::Printf(TEXT("-c:v %s -preset %s -crf %d"), *Codec, *Preset, Quality)
+        : FString::Printf(TEXT("-c:v %s -q:v %d"), *Codec, Quality);
+    Args += FString::Printf(TEXT(" -g %d -pix_fmt %s"), FMath::Max(Gop, 1), *PixelFormat);
+    if (!ExtraArgs.IsEmpty())
+    {
+        Args += TEXT(" ") + ExtraArgs;
+    }
+    return Args;
+}
+
+FString FVideoProxyProfile::GetMuxerName() const
+{
+    if (bImageSequence)
+    {
+        return TEXT("image2");
+    }
+    return Container == TEXT("mkv") ? FString(TEXT("matroska")) : Container;
+}
+
+FString FVideoProxyProfile::GetFramePattern() const
+{
+    return FString(TEXT("frame_%06d.")) + ImageExtension;
+}
+
+FString FVideoProxyProfile::GetSignature() const
+{
+    const FString Output = bImageSequence ? TEXT("seq.") + ImageExtension : Container;
+    return FString::Printf(TEXT("%d|%s|%s|%s"), ShortSide, *GetCodecArgs(), *Output, bTranscodeAll ? TEXT("all") : TEXT("cap"));
+}
+
+FVideoProxyProfiles::FVideoProxyProfiles()
+{
+    // 1080 is the original proxy; the others trade resolution or compression for faster seeks when scrubbing
+    Profiles.Add(FVideoProxyProfile());
+    Profiles.Add(MakeBuiltIn(TEXT("720Scrub"), 720, TEXT("libx264"), 23, TEXT("yuv420p"), TEXT("mp4"), TEXT("-tune fastdecode"), true));
+    Profiles.Add(MakeBuiltIn(TEXT("MJPEG720"), 720, TEXT("mjpeg"), 4, TEXT("yuvj420p"), TEXT("mov"), TEXT(""), true));
+    Profiles.Add(MakeBuiltIn(TEXT("MJPEG540"), 540, TEXT("mjpeg"), 5, TEXT("yuvj420p"), TEXT("mov"), TEXT(""), true));
+
+    // Every frame is its own file, so scrubbing never waits on a decoder seek
+    FVideoProxyProfile JpegSequence = MakeBuiltIn(TEXT("JPEGSeq720"), 720, TEXT("mjpeg"), 3, TEXT("yuvj420p"), TEXT(""), TEXT(""), true);
+    JpegSequence.bImageSequence = true;
+    Profiles.Add(JpegSequence);
+
+#if WITH_EDITOR
+    const FString& Ini = GEditorPerProjectIni;
+#else
+    const FString& Ini = GGameIni;
+#endif
+    TArray<FString> Lines;
+    GConfig->GetArray(ConfigSection, ProfilesKey, Lines, Ini);
+    for (const FString& Line : Lines)
+    {
+        FVideoProxyProfile Profile;
+        if (!ParseProfile(Line, Profile))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Ignoring proxy profile without a name: %s"), *Line);
+            continue;
+        }
+
+        // Same name replaces a built-in
+        const int32 Existing = Profiles.IndexOfByPredicate([&Profile](const FVideoProxyProfile& Other) { return Other.Name == Profile.Name; });
+        if (Existing != INDEX_NONE)
+        {
+            Profiles[Existing] = Profile;
+        }
+        else
+        {
+            Profiles.Add(Profile);
+        }
+    }
+
+    FString ActiveName;
+    if (GConfig->GetString(ConfigSection, ActiveProfileKey, ActiveName, Ini) && !ActiveName.IsEmpty())
+    {
+        ActiveIndex = Profiles.IndexOfByPredicate([&ActiveName](const FVideoProxyProfile& Profile) { return Profile.Name == ActiveName; });
+        if (ActiveIndex == INDEX_NONE)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Unknown proxy profile '%s'; using %s."), *ActiveName, *Profiles[0].Name);
+            ActiveIndex = 0;
+        }
+    }
+}
+
+const FVideoProxyProfile* FVideoProxyProfiles::Find(const FString& Name) const
+{
+    return Profiles.FindByPredicate([&Name](const FVideoProxyProfile& Profile) { return Profile.Name == Name; });
+}
+
+bool FVideoProxyProfiles::ParseProfile(const FString& Line, FVideoProxyProfile& OutProfile)
+{
+    const TCHAR* Stream = *Line;
+    FString Name;
+    if (!FParse::Value(Stream, TEXT("Name="), Name) || FPaths::MakeValidFileName(Name).IsEmpty())
+    {
+        return false;
+    }
+
+    OutProfile.Name = FPaths::MakeValidFileName(Name);
+    FParse::Value(Stream, TEXT("ShortSide="), OutProfile.ShortSide);
+    FParse::Value(Stream, TEXT("Codec="), OutProfile.Codec);
+    FParse::Value(Stream, TEXT("Preset="), OutProfile.Preset);
+    FParse::Value(Stream, TEXT("Gop="), OutProfile.Gop);
+    FParse::Value(Stream, TEXT("Quality="), OutProfile.Quality);
+    FParse::Value(Stream, TEXT("PixelFormat="), OutProfile.PixelFormat);
+    FParse::Value(Stream, TEXT("Container="), OutProfile.Container);
+    FParse::Value(Stream, TEXT("ExtraArgs="), OutProfile.ExtraArgs); // quote it if it has spaces
+    FParse::Bool(Stream, TEXT("TranscodeAll="), OutProfile.bTranscodeAll);
+    FParse::Bool(Stream, TEXT("ImageSequence="), OutProfile.bImageSequence);
+    FParse::Value(Stream, TEXT("ImageExtension="), OutProfile.ImageExtension);
+    OutProfile.ShortSide = FMath::Clamp(OutProfile.ShortSide, 144, 4320);
+    return true;
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include "CoreMinimal.h"
+
+/** How a review proxy is encoded. Every field that changes the output is part of the proxy's cache key. */
+struct FVideoProxyProfile
+{
+    FString Name = TEXT("1080");
+    int32 ShortSide = 1080; // resolution cap on the shorter side; the longer side may be up to 16:9 of it
+    FString Codec = TEXT("libx264");
+    FString Preset = TEXT("ultrafast"); // x264/x265 only
+    int32 Gop = 1; // 1 = every frame is a keyframe
+    int32 Quality = 20; // CRF for x264/x265, -q:v for everything else
+    FString PixelFormat = TEXT("yuv420p");
+    FString Container = TEXT("mp4");
+    FString ExtraArgs; // appended to the codec arguments, e.g. "-tune fastdecode"
+    bool bTranscodeAll = false; // also re-encode sources already under the cap, for the faster decode
+    bool bImageSequence = false; // numbered frames in a directory, played through UImgMediaSource
+    FString ImageExtension = TEXT("jpg"); // jpg or exr; image sequences only
+
+    bool NeedsProxy(const FIntPoint& SourceResolution) const;
+    FString GetScaleFilter(const FIntPoint& SourceResolution) const;
+    FString GetCodecArgs() const;
+    FString GetMuxerName() const; // ffmpeg -f name for Container
+    FString GetFramePattern() const; // file name pattern inside an image-sequence proxy directory
+    FString GetSignature() const;
+};
+
+/**
+ * Built-in profiles plus any defined in the ini, one per line:
+ *   +ProxyProfiles=Name=Fast540,ShortSide=540,Codec=mjpeg,Quality=4,PixelFormat=yuvj420p,Container=mov,TranscodeAll=true
+ *   +ProxyProfiles=Name=ExrSeq,ShortSide=1080,Codec=exr,PixelFormat=gbrpf32le,ImageSequence=true,ImageExtension=exr
+ * ProxyProfile=<Name> picks the one used for playback and prefetching.
+ */
+class FVideoProxyProfiles
+{
+public:
+    static FVideoProxyProfiles& Get()
+    {
+        static FVideoProxyProfiles S;
+        return S;
+    }
+
+    const FVideoProxyProfile& GetActive() const { return Profiles[ActiveIndex]; }
+    const FVideoProxyProfile* Find(const FString& Name) const;
+    const TArray<FVideoProxyProfile>& GetAll() const { return Profiles; }
+
+private:
+    FVideoProxyProfiles();
+
+    static bool ParseProfile(const FString& Line, FVideoProxyProfile& OutProfile);
+
+    TArray<FVideoProxyProfile> Profiles;
+    int32 ActiveIndex = 0;
+
+    static constexpr const TCHAR* ConfigSection = TEXT("ToucanSequencer");
+    static constexpr const TCHAR* ActiveProfileKey = TEXT("ProxyProfile");
+    static constexpr const TCHAR* ProfilesKey = TEXT("ProxyProfiles");
+};
@@ -0,0 +1,387 @@
+#include "VideoProxyQueue.h"
+#include "MediaProbeCache.h"
+#include "VideoProxyCache.h"
+#include "Async/Async.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/MonitoredProcess.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+namespace
+{
+    // ffmpeg -progress reports the encoded position in microseconds under either key, depending on version
+    bool TryParseProgressSeconds(const FString& Line, double& OutSeconds)
+    {
+        FString Value;
+        if (!Line.Split(TEXT("="), nullptr, &Value))
+        {
+            return false;
+        }
+        if (!Line.StartsWith(TEXT("out_time_us=")) && !Line.StartsWith(TEXT("out_time_ms=")))
+        {
+            return false;
+        }
+
+        OutSeconds = static_cast<double>(FCString::Atoi64(*Value)) / 1000000.0;
+        return OutSeconds >= 0.0;
+    }
+}
+
+FVideoProxyQueue::FVideoProxyQueue()
+{
+#if WITH_EDITOR
+    const FString& Ini = GEditorPerProjectIni;
+#else
+    const FString& Ini = GGameIni;
+#endif
+    GConfig->GetInt(ConfigSection, MaxConcurrentJobsKey, MaxConcurrentJobs, Ini);
+    GConfig->GetInt(ConfigSection, MaxBackgroundJobsKey, MaxBackgroundJobs, Ini);
+    MaxConcurrentJobs = FMath::Clamp(MaxConcurrentJobs, 1, 8);
+    MaxBackgroundJobs = FMath::Clamp(MaxBackgroundJobs, 0, MaxConcurrentJobs);
+}
+
+FString FVideoProxyQueue::GetCachedVideoProxyPath(const FString& VideoFilePath, const FVideoProxyProfile& Profile)
+{
+    const FString ProxyDir = FVideoProxyCache::GetProxyDirectory();
+    IFileManager::Get().MakeDirectory(*ProxyDir, true);
+
+    // Changing any encode setting yields a new file instead of reusing a proxy made differently
+    const FString HashInput = FMediaProbeCache::MakeSourceKey(VideoFilePath) + TEXT("|") + Profile.GetSignature();
+    const FString Hash = FMD5::HashAnsiString(*HashInput).Left(10);
+    const FString CleanBaseName = FPaths::MakeValidFileName(FPaths::GetBaseFilename(VideoFilePath));
+    const FString ProxyName = FString::Printf(TEXT("%s_%s_%s"), *CleanBaseName, *Hash, *Profile.Name);
+    return ProxyDir / (Profile.bImageSequence ? ProxyName : ProxyName + TEXT(".") + Profile.Container);
+}
+
+void FVideoProxyQueue::Enqueue(const FRequest& Request)
+{
+    check(IsInGameThread());
+    if (Request.SourcePath.IsEmpty() || Request.ProxyPath.IsEmpty())
+    {
+        return;
+    }
+
+    if (TSharedPtr<FJob> Existing = FindJob(Request.ProxyPath))
+    {
+        // Someone is waiting on it now; pull it ahead of the look-ahead work
+        if (Request.Priority == EPriority::Foreground && Existing->Request.Priority != EPriority::Foreground)
+        {
+            Existing->Request.Priority = EPriority::Foreground;
+            if (Existing->Process.IsValid())
+            {
+                ShowNotification(*Existing);
+            }
+        }
+        StartPendingJobs();
+        return;
+    }
+
+    TSharedRef<FJob> Job = MakeShared<FJob>();
+    Job->Id = NextJobId++;
+    Job->Request = Request;
+    Job->TempPath = Request.ProxyPath + TEXT(".part");
+    Waiting.Add(Job);
+    StartPendingJobs();
+}
+
+bool FVideoProxyQueue::IsPending(const FString& ProxyPath) const
+{
+    return FindJob(ProxyPath).IsValid();
+}
+
+void FVideoProxyQueue::Cancel(const FString& ProxyPath)
+{
+    const int32 WaitingIndex = Waiting.IndexOfByPredicate([&ProxyPath](const TSharedRef<FJob>& Job) { return Job->Request.ProxyPath == ProxyPath; });
+    if (WaitingIndex != INDEX_NONE)
+    {
+        const FRequest Request = Waiting[WaitingIndex]->Request;
+        Waiting.RemoveAt(WaitingIndex);
+        ProxyFinished.Broadcast(Request.SourcePath, Request.ProxyPath, false);
+        return;
+    }
+
+    for (const TSharedRef<FJob>& Job : Running)
+    {
+        if (Job->Request.ProxyPath == ProxyPath && !Job->bCancelled)
+        {
+            // The process reports back through OnCanceled, which finishes the job
+            Job->bCancelled = true;
+            Job->Process->Cancel(true);
+        }
+    }
+}
+
+void FVideoProxyQueue::RetainBackground(const TSet<FString>& ProxyPathsToKeep)
+{
+    TArray<FRequest> Dropped;
+    Waiting.RemoveAll([&ProxyPathsToKeep, &Dropped](const TSharedRef<FJob>& Job)
+    {
+        if (Job->Request.Priority != EPriority::Background || ProxyPathsToKeep.Contains(Job->Request.ProxyPath))
+        {
+            return false;
+        }
+        Dropped.Add(Job->Request);
+        return true;
+    });
+
+    for (const FRequest& Request : Dropped)
+    {
+        ProxyFinished.Broadcast(Request.SourcePath, Request.ProxyPath, false);
+    }
+}
+
+void FVideoProxyQueue::CancelAll()
+{
+    TArray<FString> ProxyPaths;
+    for (const TSharedRef<FJob>& Job : Waiting)
+    {
+        ProxyPaths.Add(Job->Request.ProxyPath);
+    }
+    for (const TSharedRef<FJob>& Job : Running)
+    {
+        ProxyPaths.Add(Job->Request.ProxyPath);
+    }
+    for (const FString& ProxyPath : ProxyPaths)
+    {
+        Cancel(ProxyPath);
+    }
+}
+
+void FVideoProxyQueue::Shutdown()
+{
+    Waiting.Reset();
+    for (const TSharedRef<FJob>& Job : Running)
+    {
+        Job->bCancelled = true;
+        Job->Process->OnOutput().Unbind();
+        Job->Process->OnCompleted().Unbind();
+        Job->Process->OnCanceled().Unbind();
+        Job->Process->Cancel(true);
+    }
+
+    // Dropping the last reference joins each process's monitor thread
+    for (const TSharedRef<FJob>& Job : Running)
+    {
+        Job->Process.Reset();
+        FVideoProxyCache::DeleteProxy(Job->TempPath);
+    }
+    Running.Reset();
+}
+
+void FVideoProxyQueue::StartPendingJobs()
+{
+    while (Running.Num() < MaxConcurrentJobs && Waiting.Num() > 0)
+    {
+        int32 NextIndex = Waiting.IndexOfByPredicate([](const TSharedRef<FJob>& Job) { return Job->Request.Priority == EPriority::Foreground; });
+        if (NextIndex == INDEX_NONE)
+        {
+            const int32 RunningBackground = Running.FilterByPredicate([](const TSharedRef<FJob>& Job) { return Job->Request.Priority == EPriority::Background; }).Num();
+            if (RunningBackground >= MaxBackgroundJobs)
+            {
+                break;
+            }
+            NextIndex = 0;
+        }
+
+        TSharedRef<FJob> Job = Waiting[NextIndex];
+        Waiting.RemoveAt(NextIndex);
+        StartJob(Job);
+    }
+}
+
+void FVideoProxyQueue::StartJob(const TSharedRef<FJob>& Job)
+{
+    const int32 JobId = Job->Id;
+    FVideoProxyCache::DeleteProxy(Job->TempPath);
+    if (Job->Request.Profile.bImageSequence)
+    {
+        IFileManager::Get().MakeDirectory(*Job->TempPath, true);
+    }
+
+    Job->Process = MakeShared<FMonitoredProcess>(TEXT("ffmpeg"), BuildFfmpegArgs(Job->Request, Job->TempPath), true, true);
+
+    // The monitor thread calls these; everything that touches jobs happens back on the game thread
+    Job->Process->OnOutput().BindLambda([this, JobId](FString Output)
+    {
+        double EncodedSeconds = 0.0;
+        if (TryParseProgressSeconds(Output, EncodedSeconds))
+        {
+            AsyncTask(ENamedThreads::GameThread, [this, JobId, EncodedSeconds]() { UpdateProgress(JobId, EncodedSeconds); });
+        }
+    });
+    Job->Process->OnCompleted().BindLambda([this, JobId](int32 ReturnCode)
+    {
+        AsyncTask(ENamedThreads::GameThread, [this, JobId, ReturnCode]() { FinishJob(JobId, ReturnCode); });
+    });
+    Job->Process->OnCanceled().BindLambda([this, JobId]()
+    {
+        AsyncTask(ENamedThreads::GameThread, [this, JobId]() { FinishJob(JobId, INDEX_NONE); });
+    });
+
+    Running.Add(Job);
+    if (Job->Request.Priority == EPriority::Foreground)
+    {
+        ShowNotification(*Job);
+    }
+
+    if (!Job->Process->Launch())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Video proxy skipped: ffmpeg was not found on PATH."));
+        if (Job->Notification.IsValid())
+        {
+            Job->Notification->SetText(FText::FromString(TEXT("ffmpeg not found; using original video.")));
+        }
+        FinishJob(JobId, INDEX_NONE);
+        return;
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Creating review proxy in the background: %s"), *Job->Request.ProxyPath);
+}
+
+void FVideoProxyQueue::FinishJob(int32 JobId, int32 ReturnCode)
+{
+    const int32 RunningIndex = Running.IndexOfByPredicate([JobId](const TSharedRef<FJob>& Job) { return Job->Id == JobId; });
+    if (RunningIndex == INDEX_NONE)
+    {
+        return; // already finished, e.g. canceled and completed both reported
+    }
+
+    const TSharedRef<FJob> Job = Running[RunningIndex];
+    Running.RemoveAt(RunningIndex);
+
+    bool bSuccess = !Job->bCancelled && ReturnCode == 0 && FVideoProxyCache::GetProxySize(Job->TempPath) > 0;
+    if (bSuccess && !IFileManager::Get().Move(*Job->Request.ProxyPath, *Job->TempPath, true, true))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Could not move finished proxy into place: %s"), *Job->Request.ProxyPath);
+        bSuccess = false;
+    }
+    if (bSuccess)
+    {
+        FVideoProxyCache::Get().RecordProxy(Job->Request.ProxyPath, FMediaProbeCache::MakeSourceKey(Job->Request.SourcePath), Job->Request.Profile.Name);
+    }
+    else
+    {
+        FVideoProxyCache::DeleteProxy(Job->TempPath);
+    }
+
+    if (Job->bCancelled)
+    {
+        UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Video proxy canceled: %s"), *Job->Request.ProxyPath);
+    }
+    else if (bSuccess)
+    {
+        UE_LOG(LogTemp, Display, TEXT("[ToucanSequencer] Created %s review proxy: %s"), *Job->Request.Profile.Name, *Job->Request.ProxyPath);
+    }
+    else if (ReturnCode != INDEX_NONE)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ToucanSequencer] Video proxy creation failed with exit code %d: %s"), ReturnCode, *Job->Request.SourcePath);
+    }
+
+    if (Job->Notification.IsValid())
+    {
+        if (bSuccess)
+        {
+            Job->Notification->SetText(FText::FromString(FString::Printf(TEXT("%s video proxy ready."), *Job->Request.Profile.Name)));
+        }
+        else if (Job->bCancelled)
+        {
+            Job->Notification->SetText(FText::FromString(TEXT("Video proxy canceled; using original video.")));
+        }
+        else if (ReturnCode != INDEX_NONE)
+        {
+            Job->Notification->SetText(FText::FromString(TEXT("Video proxy creation failed; using original video.")));
+        }
+        Job->Notification->SetCompletionState(bSuccess ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+        Job->Notification->ExpireAndFadeout();
+    }
+
+    ProxyFinished.Broadcast(Job->Request.SourcePath, Job->Request.ProxyPath, bSuccess);
+    StartPendingJobs();
+}
+
+void FVideoProxyQueue::UpdateProgress(int32 JobId, double EncodedSeconds)
+{
+    TSharedPtr<FJob> Job = FindJob(JobId);
+    if (!Job.IsValid() || !Job->Notification.IsValid())
+    {
+        return;
+    }
+
+    Job->EncodedSeconds = EncodedSeconds;
+    const double Duration = Job->Request.DurationSeconds;
+    const FString Text = Duration > 0.0
+        ? FString::Printf(TEXT("Creating %s video proxy... %d%%"), *Job->Request.Profile.Name, FMath::Clamp(FMath::RoundToInt(100.0 * EncodedSeconds / Duration), 0, 100))
+        : FString::Printf(TEXT("Creating %s video proxy... %.0fs encoded"), *Job->Request.Profile.Name, EncodedSeconds);
+    Job->Notification->SetText(FText::FromString(Text));
+}
+
+void FVideoProxyQueue::ShowNotification(FJob& Job)
+{
+    if (Job.Notification.IsValid())
+    {
+        return;
+    }
+
+    const FString ProxyPath = Job.Request.ProxyPath;
+    FNotificationInfo Info(FText::FromString(FString::Printf(TEXT("Creating %s video proxy..."), *Job.Request.Profile.Name)));
+    Info.bFireAndForget = false;
+    Info.FadeOutDuration = 0.5f;
+    Info.ExpireDuration = 2.0f;
+    Info.ButtonDetails.Add(FNotificationButtonInfo(
+        FText::FromString(TEXT("Cancel")),
+        FText::FromString(TEXT("Stop creating this proxy and keep playing the original video.")),
+        FSimpleDelegate::CreateLambda([this, ProxyPath]() { Cancel(ProxyPath); }),
+        SNotificationItem::CS_Pending));
+
+    Job.Notification = FSlateNotificationManager::Get().AddNotification(Info);
+    if (Job.Notification.IsValid())
+    {
+        Job.Notification->SetCompletionState(SNotificationItem::CS_Pending);
+    }
+}
+
+TSharedPtr<FVideoProxyQueue::FJob> FVideoProxyQueue::FindJob(int32 JobId) const
+{
+    for (const TSharedRef<FJob>& Job : Running)
+    {
+        if (Job->Id == JobId)
+        {
+            return Job;
+        }
+    }
+    return nullptr;
+}
+
+TSharedPtr<FVideoProxyQueue::FJob> FVideoProxyQueue::FindJob(const FString& ProxyPath) const
+{
+    for (const TArray<TSharedRef<FJob>>* Jobs : { &Running, &Waiting })
+    {
+        for (const TSharedRef<FJob>& Job : *Jobs)
+        {
+            if (Job->Request.ProxyPath == ProxyPath)
+            {
+                return Job;
+            }
+        }
+    }
+    return nullptr;
+}
+
+FString FVideoProxyQueue::BuildFfmpegArgs(const FRequest& Request, const FString& OutputPath)
+{
+    // Output goes to a temporary name, so the container has to be named explicitly
+    const FVideoProxyProfile& Profile = Request.Profile;
+    const FString OutputTarget = Profile.bImageSequence
+        ? FString::Printf(TEXT("-start_number 0 \"%s\""), *(OutputPath / Profile.GetFramePattern()))
+        : FString::Printf(TEXT("\"%s\""), *OutputPath);
+    return FString::Printf(
+        TEXT("-y -hide_banner -loglevel error -nostats -progress pipe:1 -i \"%s\" -vf %s %s -an -f %s %s"),
+        *Request.SourcePath,
+        *Profile.GetScaleFilter(Request.SourceResolution),
+        *Profile.GetCodecArgs(),
+        *Profile.GetMuxerName(),
+        *OutputTarget);
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "VideoProxyProfile.h"
+
+class FMonitoredProcess;
+class SNotificationItem;
+
+/**
+ * Builds review proxies with background ffmpeg processes, a few at a time.
+ * Each job encodes to a temporary file that is renamed into place only once ffmpeg succeeds,
+ * so a proxy path that exists is always complete. Game thread only.
+ */
+class FVideoProxyQueue
+{
+public:
+    static FVideoProxyQueue& Get()
+    {
+        static FVideoProxyQueue S;
+        return S;
+    }
+
+    enum class EPriority : uint8
+    {
+        Foreground, // the clip being worked on; shows a cancellable notification
+        Background, // look-ahead work; runs only when no foreground job is waiting, at most MaxBackgroundJobs at once
+    };
+
+    struct FRequest
+    {
+        FString SourcePath;
+        FString ProxyPath;
+        FIntPoint SourceResolution = FIntPoint::ZeroValue;
+        double DurationSeconds = 0.0; // for progress; 0 if unknown
+        FVideoProxyProfile Profile;
+        EPriority Priority = EPriority::Foreground;
+    };
+
+    /** Fires on the game thread when a job ends; bSuccess is false for failures and cancellations */
+    DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnProxyFinished, const FString& /*SourcePath*/, const FString& /*ProxyPath*/, bool /*bSuccess*/);
+    FOnProxyFinished& OnProxyFinished() { return ProxyFinished; }
+
+    static FString GetCachedVideoProxyPath(const FString& VideoFilePath, const FVideoProxyProfile& Profile);
+
+    void Enqueue(const FRequest& Request); // ignored if that proxy is already queued or running; raises priority if needed
+    bool IsPending(const FString& ProxyPath) const;
+    void Cancel(const FString& ProxyPath);
+    void RetainBackground(const TSet<FString>& ProxyPathsToKeep); // drops waiting background jobs not in the set
+    void CancelAll();
+    void Shutdown(); // cancels everything and waits for the processes to exit
+
+private:
+    struct FJob
+    {
+        int32 Id = 0;
+        FRequest Request;
+        FString TempPath;
+        TSharedPtr<FMonitoredProcess> Process;
+        TSharedPtr<SNotificationItem> Notification;
+        double EncodedSeconds = 0.0;
+        bool bCancelled = false;
+    };
+
+    FVideoProxyQueue();
+
+    void StartPendingJobs();
+    void StartJob(const TSharedRef<FJob>& Job);
+    void FinishJob(int32 JobId, int32 ReturnCode);
+    void UpdateProgress(int32 JobId, double EncodedSeconds);
+    void ShowNotification(FJob& Job);
+    TSharedPtr<FJob> FindJob(int32 JobId) const;
+    TSharedPtr<FJob> FindJob(const FString& ProxyPath) const;
+
+    static FString BuildFfmpegArgs(const FRequest& Request, const FString& OutputPath);
+
+    TArray<TSharedRef<FJob>> Waiting;
+    TArray<TSharedRef<FJob>> Running;
+    int32 NextJobId = 1;
+    int32 MaxConcurrentJobs = 2;
+    int32 MaxBackgroundJobs = 1; // leaves a slot free for the clip being opened
+    FOnProxyFinished ProxyFinished;
+
+    static constexpr const TCHAR* ConfigSection = TEXT("ToucanSequencer");
+    static constexpr const TCHAR* MaxConcurrentJobsKey = TEXT("ProxyMaxConcurrentJobs");
+    static constexpr const TCHAR* MaxBackgroundJobsKey = TEXT("ProxyMaxBackgroundJobs");
+};
@@ -12,6 +12,7 @@ class ULevelSequence;
 class UMovieSceneSection;
 class ASkeletalMeshActor;
 class UControlRig;
+class UMovieSceneControlRigParameterTrack;
 class UToucanBakedAnimMetadata;
 
 /**
@@ -24,12 +25,17 @@ public:
     static void LoadNextAnimation(TSoftObjectPtr<USkeletalMesh> SkeletalMesh,
                                   TSoftObjectPtr<UObject> Rig,
                                   UAnimSequence* Animation);
+    /** Builds the clip into the standby sequence while the current one is edited; LoadNextAnimation then only switches to it */
+    static void PrepareNextAnimation(TSoftObjectPtr<USkeletalMesh> SkeletalMesh,
+                                     TSoftObjectPtr<UObject> Rig,
+                                     UAnimSequence* Animation,
+                                     const FString& VideoFilePath);
     static FGuid FindBindingForObject(
         const ULevelSequence* LevelSequence,
         UObject* InObject,
         TSharedPtr<const UE::MovieScene::FSharedPlaybackState> Shared = nullptr);
 
-    static ULevelSequence* CreateOrLoadLevelSequence();
+    static ULevelSequence* CreateOrLoadLevelSequence(); // the pooled sequence the next clip goes into
     static ULevelSequence* CreateOrLoadLevelSequence(const FString& Path, USkeletalMesh* Mesh, UObject* Rig);
     static void SetActiveSequence(ULevelSequence* Sequence) { ActiveSequence = Sequence; }
     static ULevelSequence* GetActiveSequence() { return ActiveSequence.Get(); }
@@ -42,6 +48,7 @@ public:
     static void LoadVideoForCurrentSequence(const FString& VideoFilePath);
     static UControlRig* GetActiveRig();
     static void RemoveRigFromSequence(ULevelSequence* LevelSequence);
+    static void Shutdown(); // stops following level changes and actor deletion
 
     static void BakeAndSave();
     static void StepFrames(int32 Frames);
@@ -56,8 +63,13 @@ private:
 private:
     // --- Internal helpers ---
     static ASkeletalMeshActor* SpawnOrFindSkeletalMeshActor(UWorld* World, TSoftObjectPtr<USkeletalMesh> SkeletalMesh);
+    static ULevelSequence* CreateOrLoadPoolSequence(int32 SlotIndex);
+    static bool BuildClipIntoSequence(ULevelSequence* LevelSequence, TSoftObjectPtr<USkeletalMesh> SkeletalMesh, TSoftObjectPtr<UObject> Rig,
+                                      UAnimSequence* Animation, bool bCanCreateRigTrack, bool& bOutRigTrackReady);
     static UMovieSceneSection* AddAnimationTrack(ULevelSequence* LevelSequence, UAnimSequence* Animation, FGuid BindingID, bool bSetAnimRange = true);
     static void AddRigToSequence(ULevelSequence* LevelSequence, TSoftObjectPtr<UObject> Rig);
+    static UMovieSceneControlRigParameterTrack* FindReusableRigTrack(ULevelSequence* LevelSequence, USkeletalMesh* Mesh, UObject* RigObject);
+    static void ResetRigTrackKeys(ULevelSequence* LevelSequence, UMovieSceneControlRigParameterTrack* RigTrack);
     static ULevelSequence* CreateLevelSequenceAsset(const FString& FolderPath, const FString& AssetName);
 
 private:
@@ -2,6 +2,7 @@
 #include "CoreMinimal.h"
 
 struct FAssetData;
+class FSeqQueueWriter;
 
 /** Storage format for each queued animation */
 struct FQueuedAnim
@@ -11,19 +12,44 @@ struct FQueuedAnim
     bool bProcessed = false;
     bool bCheckpointed = false;
     FString CheckpointPath;
+    FString MatchedVideoPath; // best video from the last match run; empty if nothing scored high enough
+    int32 MatchedVideoScore = INDEX_NONE; // INDEX_NONE until a match run has looked at this item
+
+    bool HasVideoMatchResult() const { return MatchedVideoScore != INDEX_NONE; }
 
     bool operator==(const FQueuedAnim& Other) const
     { return Path == Other.Path; }
 };
 
+/** One contiguous range of rows that changed; listeners replay these in order to patch their own copy of the queue */
+struct FSeqQueueChange
+{
+    enum class EType : uint8
+    {
+        Reset,    // anything may have changed, rebuild from GetAll()
+        Inserted, // [Index, Index + Count) are new
+        Removed,  // [Index, Index + Count) are gone
+        Updated,  // [Index, Index + Count) changed in place
+    };
+
+    EType Type = EType::Reset;
+    int32 Index = 0;
+    int32 Count = 0;
+};
+
 namespace SeqCfg
 {
     inline constexpr const TCHAR* Section = TEXT("ToucanSequencer");
     inline constexpr const TCHAR* Key     = TEXT("Queue"); // array of soft paths
     inline constexpr const TCHAR* CurrentIndexKey = TEXT("CurrentIndex");
+    inline constexpr const TCHAR* PersistCoalesceSecondsKey = TEXT("PersistCoalesceSeconds"); // journal write batching window
 }
 
-/** Tiny, editor-only, in-memory queue with config persistence */
+/**
+ * Tiny, editor-only, in-memory queue.
+ * Persisted as an append-only journal in Saved/ToucanSessionSequencer/Queue.journal, one record per mutation.
+ * Disk writes happen on a background thread; call FlushNow() before anything that must see them.
+ */
 class FSeqQueue
 {
 public:
@@ -33,42 +59,105 @@ public:
         return S;
     }
 
+    /** A queue that lives only in memory: no journal is read or written. For benchmarks; not the session queue. */
+    static TUniquePtr<FSeqQueue> CreateScratch();
+    ~FSeqQueue();
+
     DECLARE_MULTICAST_DELEGATE(FOnQueueChanged);
     FOnQueueChanged& OnQueueChanged() { return QueueChanged; }
 
+    /** Fires before OnQueueChanged with the row ranges touched since the last broadcast */
+    DECLARE_MULTICAST_DELEGATE_OneParam(FOnQueueItemsChanged, const FSeqQueueChange&);
+    FOnQueueItemsChanged& OnQueueItemsChanged() { return QueueItemsChanged; }
+
     void Load();
-    void Save() const;
+    void Save(); // compacts the journal into a snapshot of the current queue
+    void FlushNow(); // blocks until every mutation so far is on disk
+    void ShutdownPersistence(); // flushes and stops the background writer; later writes go straight to disk
 
     void Clear();
     void Add(const FAssetData& A);
     void AddPath(const FSoftObjectPath& P, const FText& Nice);
+    int32 AddBatch(const TArray<FAssetData>& Assets); // dedupes, persists and broadcasts once; returns number added
     bool RemoveAt(int32 Index);
+    int32 RemoveAll(TFunctionRef<bool(const FQueuedAnim&)> Predicate); // one pass, persists and broadcasts once; returns number removed
     const TArray<FQueuedAnim>& GetAll() const { return Items; }
 
     int32 GetCurrentIndex() const { return CurrentIndex; }
     void SetCurrentIndex(int32 NewIndex);
 
     int32 GetTotalCount() const { return Items.Num(); }
-    int32 GetProcessedCount();
-    void RefreshProcessedCount(); // Call this after marking animations as processed
+    int32 GetProcessedCount() const { return ProcessedCount; }
+    int32 GetCheckpointedCount() const { return CheckpointedCount; }
+    void RefreshProcessedCount(); // Broadcasts a UI refresh; the counters themselves are always current
+    int32 FindNextUnprocessed(int32 StartIndex) const; // first unprocessed after StartIndex, wrapping; INDEX_NONE if all done
+    int32 FindIndexByPath(const FSoftObjectPath& Path) const; // O(1) through the path index
     bool IsProcessed(const FSoftObjectPath& Path) const;
     bool TryGetCheckpointPath(const FSoftObjectPath& Path, FString& OutCheckpointPath) const;
     void SetProcessed(const FSoftObjectPath& Path, bool bProcessed);
     void SetCheckpoint(const FSoftObjectPath& Path, const FString& CheckpointPath);
     void ClearCheckpoint(const FSoftObjectPath& Path);
+    void SetVideoMatch(const FSoftObjectPath& Path, const FString& VideoPath, int32 Score);
+    void ClearVideoMatches(); // e.g. after the video folder changes; persists one snapshot
+
+    /** Defers journal writes and the change broadcast until the outermost batch scope ends */
+    class FScopedBatch
+    {
+    public:
+        FScopedBatch() { FSeqQueue::Get().BeginBatch(); }
+        ~FScopedBatch() { FSeqQueue::Get().EndBatch(); }
+        UE_NONCOPYABLE(FScopedBatch);
+    };
     
 private:
     int32 CurrentIndex = INDEX_NONE;
-    mutable int32 CachedProcessedCount = -1; // -1 means invalid cache
-    FSeqQueue() { Load(); }
+    FSeqQueue();
+    enum class EScratch : uint8 { Scratch };
+    explicit FSeqQueue(EScratch);
 
     bool CheckBoundsIndex(int32 Index) const { return Index >= 0 && Index < Items.Num(); }
 
     static FText MakeDisplayName(const FAssetData& A);
-    int32 FindIndexByPath(const FSoftObjectPath& Path) const;
+    bool AppendUnique(FQueuedAnim&& Q); // false if the path is already queued
+    void ReindexFrom(int32 FirstIndex); // refresh PathToIndex after items shift
+    void RemoveItemAt(int32 Index);
+    void RebuildDerivedState(); // PathToIndex, bitsets and counters from Items
+    void ResetItems();
+    void ApplyProcessed(int32 Index, bool bProcessed);
+    void ApplyCheckpoint(int32 Index, const FString& CheckpointPath);
+    void ApplyVideoMatch(int32 Index, const FString& VideoPath, int32 Score);
+
+    void BeginBatch();
+    void EndBatch();
+    void CommitChange(); // Flush journal + broadcast, or defer while a batch is open
+    void RecordChange(FSeqQueueChange::EType Type, int32 Index, int32 Count = 1);
+    void BroadcastChanges();
+
+    int32 BatchDepth = 0;
+    bool bBatchDirty = false;
+    TArray<FSeqQueueChange> PendingChanges; // coalesced row ranges since the last broadcast
+
+    // --- journal ---
+    void MigrateFromConfig(); // one-time import of the old ini arrays
+    void ReplayRecord(const FString& Line);
+    void JournalAdd(const FQueuedAnim& Q);
+    void JournalRecord(const FString& Record);
+    void FlushJournal();
+    int32 GetCompactionThreshold() const;
+
+    FString PendingJournal; // records not yet handed to the writer
+    TUniquePtr<FSeqQueueWriter> Writer;
+    int32 RecordsSinceCompaction = 0;
+    bool bInMemoryOnly = false; // scratch queue: journal records are dropped
 
 private:
     TArray<FQueuedAnim> Items;
+    TMap<FSoftObjectPath, int32> PathToIndex; // kept in sync with Items on add, remove and clear
+    TBitArray<> ProcessedBits; // mirrors FQueuedAnim::bProcessed per index
+    TBitArray<> CheckpointedBits; // mirrors FQueuedAnim::bCheckpointed per index
+    int32 ProcessedCount = 0;
+    int32 CheckpointedCount = 0;
     FOnQueueChanged QueueChanged;
+    FOnQueueItemsChanged QueueItemsChanged;
 
 };
@@ -28,9 +28,12 @@ public class ToucanSessionSequencer : ModuleRules
             "UnrealEd",
             "AssetRegistry",
             "AssetTools",
+            "DirectoryWatcher",
+            "Json",
             "ContentBrowser",
             "DesktopPlatform",
             "EditorStyle",
+            "ImgMedia",
             "MediaPlate",
             "Projects",
             "InputCore",